@@ -31,11 +31,24 @@
 // Long press duration
 #define LONG_PRESS_DURATION 500 // Time in ms to detect long press
 
+// M5StickC Plus2 buttons (see utils/DeviceButtons.h), active low
+#define BUTTON_A_PIN 37               // Front button
+#define BUTTON_B_PIN 39               // Side button
+#define BUTTON_DEBOUNCE_MS 20         // Level must hold this long after the last edge
+#define BUTTON_REPEAT_MS 250          // Repeat period while held after a long press
+#define BUTTON_EVENT_QUEUE_LENGTH 16  // Events waiting for the render task
+
+// Gestures
+#define GESTURE_CHORD_WINDOW_MS 150 // Max time between the two presses of a chord
+#define GESTURE_MAX_BINDINGS 32     // Gesture table rows the engine can index
+
 // Define CRSF pin and constants
 #define CRSF_TX_PIN 26       // GPIO pin for CRSF (single-wire, half-duplex)
 #define CRSF_BAUDRATE 420000 // CRSF standard baudrate
 #define CRSF_PACKET_SIZE 64  // Maximum CRSF packet size
 #define BIT_TIME_US (1000000 / CRSF_BAUDRATE)  // Microseconds per bit at CRSF baudrate
+#define CRSF_STATS_INTERVAL_MS 5000          // Period of the frame timing log line
+#define CRSF_FRAME_INTERVAL_MS 20            // 50Hz frame rate, on the FreeRTOS tick grid
 
 // CRSF specific defines
 #define CRSF_SYNC_BYTE 0xC8
@@ -66,4 +79,116 @@
 // Trigger bar positions
 #define LEFT_TRIGGER_X 20
 #define RIGHT_TRIGGER_X 90
-#define TRIGGERS_Y 95 
\ No newline at end of file
+#define TRIGGERS_Y 95
+
+// Reconnect after a dropout (pages the saved controller, no BT stack restart)
+#define RECONNECT_BACKOFF_MIN_MS 250     // First page right away, then this long before the next
+#define RECONNECT_BACKOFF_MAX_MS 4000    // Backoff doubles per attempt up to this
+
+// BLE HID gamepad input instead of the DualSense (set by the esp32-ble-gamepad environment)
+#ifndef BLE_GAMEPAD
+#define BLE_GAMEPAD 0
+#endif
+#define BLE_CONN_INTERVAL 6              // Connection interval in 1.25 ms units (6 = 7.5 ms, the minimum)
+#define BLE_SUPERVISION_TIMEOUT 200      // Link supervision timeout in 10 ms units
+#define BLE_CONNECT_TIMEOUT_S 3          // Direct connect attempt to a bonded gamepad
+#define BLE_SCAN_WINDOW_S 5              // Scan length before trying the bonded gamepad again
+#define HID_MAX_FIELDS 40                // Decoded fields kept from a report descriptor
+
+// Bonded controllers (any of them may connect, each with its own profile)
+#define BOND_TABLE_SIZE 4                // Controllers remembered, least recently used is replaced
+#define BOND_LABEL_SIZE 16               // Label bytes per controller, including the terminator
+#define BOND_ROTATE_DWELL_MS 3000        // Time the ps5 library waits for each bond while none is connected
+
+// Flight recorder (delta-encoded RAM ring flushed to LittleFS on trigger)
+#define RECORDER_BLOCK_SIZE 512          // Bytes per ring block, each starts with a keyframe
+#define RECORDER_BLOCK_COUNT 16          // Blocks in the RAM ring (8KB, roughly 5-60s of history)
+#define RECORDER_POST_TRIGGER_BLOCKS 4   // Blocks recorded after the trigger
+#define RECORDER_MAX_FILES 8             // Oldest recordings are removed beyond this
+#define RECORDER_FLUSH_TIMEOUT_MS 10000  // Give up waiting for post-trigger blocks
+#define RECORDER_TRIGGER_ON_LINK_LOSS 1  // Save a recording when the controller disconnects
+
+// Deferred logging (see utils/Log.h)
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO         // Calls above this level are compiled out
+#endif
+#define LOG_RING_SIZE 64                 // Records buffered for the drain task
+#define LOG_STRING_SIZE 32               // Bytes per record for copied string arguments
+#define LOG_DRAIN_INTERVAL_MS 20         // Drain task polling period
+
+// Display rendering
+#define CONTROLLER_SCREEN_DIRECT 0       // 1 = draw straight to the panel (benchmark baseline)
+#define RENDER_STATS_INTERVAL_MS 5000    // Period of the render benchmark log line
+#define SCREEN_MAX_DIRTY_RECTS 8         // Changed areas tracked per frame before merging
+#define WIDGET_LABEL_SIZE 24             // Characters per label or list row, including the terminator
+#define WIDGET_LIST_MAX_ROWS 16          // Rows per list widget (two per Bluetooth menu item)
+#define UI_FRAME_RATE 30                 // Render task frame cap while inputs change
+#define UI_IDLE_FRAME_RATE 5             // Frame cap once nothing changed for UI_IDLE_AFTER_MS
+#define UI_IDLE_AFTER_MS 1000
+#define UI_REDUCED_FRAME_RATE 10         // Frame cap from DISPLAY_REDUCED_AFTER_MS on
+#define DISPLAY_REDUCED_AFTER_MS 10000   // Connected without a button or status change this long
+#define DISPLAY_DIM_AFTER_MS 30000       // ... backlight dimmed, UI_IDLE_FRAME_RATE
+#define DISPLAY_BLANK_AFTER_MS 60000     // ... backlight off, screens no longer updated
+#define DISPLAY_DIM_BRIGHTNESS 16        // Backlight level while dimmed (0-255)
+#define LOGO_DISPLAY_MS 2000             // Logo time at boot; RF and Bluetooth start without waiting for it
+#ifndef LOGO_PNG
+#define LOGO_PNG 0                       // 1 = decode the PNG in logo.h instead of streaming logo_rle.h
+#endif
+#define LOGO_CHUNK_LINES 8               // Logo lines decoded and sent to the panel at a time
+#define UI_COMMAND_QUEUE_LENGTH 8        // Screen switches and button events waiting for the render task
+#define DIALOG_MAX_LINES 12              // Text lines of a modal dialog
+
+// Bluetooth discovery
+#define DISCOVERY_QUEUE_SIZE 32          // Discovery results waiting for the UI task (power of two)
+#define DISCOVERY_NAME_SIZE 32           // Bytes of device name kept per result, including the terminator
+#define DISCOVERY_RSSI_UNKNOWN -128      // RSSI of results that did not report one
+#define BT_SETTLE_MS 100                 // Pause after starting Bluetooth or stopping a discovery
+#define PARTIAL_MAC_DIALOG_MS 5000       // Partial MAC warning, or until a button is pressed
+#define DEVICE_TABLE_SIZE 50             // Devices kept in the Bluetooth menu
+#define DEVICE_TABLE_HASH_SIZE 128       // MAC hash buckets (power of two, above DEVICE_TABLE_SIZE)
+
+// Input report meter (see controllers/ReportRateMeter.h)
+#define REPORT_GAP_THRESHOLD_MS 20       // Inter-arrival counted as an input gap
+#define REPORT_SESSION_GAP_MS 2000       // Silence treated as a link restart, not a gap
+#define REPORT_STATS_INTERVAL_MS 5000    // Period of the report meter log lines
+#define REPORT_QUEUE_SIZE 32             // Reports waiting for the loop task (power of two); the loop
+                                         // drains it once per CRSF frame, about 5 DualSense reports
+
+// Settings (see utils/ConfigStore.h)
+#define CONFIG_WRITE_DELAY_MS 2000       // Quiet time after the last change before it is written
+#define CONFIG_WRITE_MAX_DELAY_MS 10000  // Longest a change waits while others keep arriving
+
+// Power management (see utils/PowerManager.h)
+#define POWER_MODE_PERFORMANCE 0         // CPU at POWER_MAX_FREQ_MHZ all the time
+#define POWER_MODE_DFS 1                 // CPU drops to POWER_MIN_FREQ_MHZ between frames
+#define POWER_MODE_LIGHT_SLEEP 2         // DFS, plus light sleep when idle (needs tickless idle)
+#ifndef POWER_MODE
+#define POWER_MODE POWER_MODE_DFS
+#endif
+#define POWER_MAX_FREQ_MHZ 240           // Clock of the RF and input work window
+#define POWER_MIN_FREQ_MHZ 80            // Lowest clock that keeps the APB (UART, SPI) at 80MHz
+#define POWER_STATS_INTERVAL_MS 5000     // Period of the power log line
+
+// Heap allocation counter for the main loop (set by the esp32-alloc-counter environment)
+#ifndef HEAP_ALLOC_COUNTER
+#define HEAP_ALLOC_COUNTER 0
+#endif
+#define ALLOC_REPORT_INTERVAL_MS 5000    // Period of the loop allocation log line
+
+// Release profile (set by the esp32-release environment): the RF and input
+// hot paths run from IRAM and the tables they read live in DRAM, which takes
+// flash cache misses out of the bit timing and the mapping. Not everything
+// they call is in IRAM (the flight recorder, channel reads, micros()), and a
+// flash write on core 0 still pauses core 1, so frames can still be delayed.
+// Empty on host builds.
+#ifndef FIRMWARE_RELEASE
+#define FIRMWARE_RELEASE 0
+#endif
+#if FIRMWARE_RELEASE
+#include <esp_attr.h>
+#define HOT_FUNC IRAM_ATTR
+#define HOT_DATA DRAM_ATTR
+#else
+#define HOT_FUNC
+#define HOT_DATA
+#endif
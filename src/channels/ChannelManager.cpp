@@ -32,7 +32,7 @@ ChannelManager::ChannelManager() {
     }
 }
 
-void ChannelManager::setChannel(uint8_t channel, uint16_t value) {
+HOT_FUNC void ChannelManager::setChannel(uint8_t channel, uint16_t value) {
     if (channel < NUM_CHANNELS) {
         channels[channel] = value;
     }
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BLEGamepadController.h"
+
+#if BLE_GAMEPAD
+
+#include "../utils/Log.h"
+#include "../utils/BootTimeline.h"
+
+// GATT UUIDs of the HID service
+#define HID_SERVICE_UUID 0x1812
+#define HID_REPORT_MAP_UUID 0x2A4B
+#define HID_REPORT_UUID 0x2A4D
+#define HID_REPORT_REFERENCE_UUID 0x2908
+
+// Appearance values accepted from advertisements (0 = not advertised)
+#define APPEARANCE_JOYSTICK 0x03C3
+#define APPEARANCE_GAMEPAD 0x03C4
+
+// Input report characteristics followed per gamepad
+#define BLE_MAX_REPORTS 4
+
+BLEGamepadController::ReportSlot BLEGamepadController::reportSlots[BLE_MAX_REPORTS];
+int BLEGamepadController::reportSlotCount = 0;
+HidReportMap BLEGamepadController::reportMap;
+PS5Report BLEGamepadController::latestReport;
+ReportQueue BLEGamepadController::reports;
+portMUX_TYPE BLEGamepadController::meterLock = portMUX_INITIALIZER_UNLOCKED;
+ReportRateMeter BLEGamepadController::meter;
+volatile bool BLEGamepadController::linkUp = false;
+
+BLEGamepadController::BLEGamepadController(ChannelManager* channelManager) :
+    Controller(channelManager),
+    client(nullptr),
+    linkTaskHandle(nullptr),
+    mapper(channelManager) {
+    memset(&latestReport, 0, sizeof(latestReport));
+}
+
+bool BLEGamepadController::begin() {
+    NimBLEDevice::init("");
+    BootTimeline::mark(BOOT_BT_STARTED);
+    
+    // Bond so the next connect is direct, without a scan
+    NimBLEDevice::setSecurityAuth(true, false, true);
+    
+    client = NimBLEDevice::createClient();
+    client->setClientCallbacks(&linkCallbacks, false);
+    client->setConnectTimeout(BLE_CONNECT_TIMEOUT_S);
+    
+    // Connecting blocks for seconds, keep it off the loop task
+    BaseType_t created = xTaskCreatePinnedToCore(linkTaskEntry, "ble", 4096, this, 1, &linkTaskHandle, 0);
+    if (created != pdPASS) {
+        LOG_E(LOG_INPUT, "Failed to start BLE link task");
+        linkTaskHandle = nullptr;
+        return false;
+    }
+    
+    setStatus(STATUS_WAITING);
+    LOG_I(LOG_INPUT, "BLE gamepad input started, %u bonded", NimBLEDevice::getNumBonds());
+    return true;
+}
+
+void BLEGamepadController::linkTaskEntry(void* param) {
+    static_cast<BLEGamepadController*>(param)->linkTask();
+}
+
+void BLEGamepadController::linkTask() {
+    NimBLEScan* scan = NimBLEDevice::getScan();
+    scan->setActiveScan(true);
+    
+    while (true) {
+        if (linkUp) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        
+        // A bonded gamepad is connected directly
+        if (NimBLEDevice::getNumBonds() > 0 && connectTo(NimBLEDevice::getBondedAddress(0))) {
+            continue;
+        }
+        
+        // Otherwise connect to the first gamepad advertising HID
+        NimBLEScanResults results = scan->start(BLE_SCAN_WINDOW_S, false);
+        for (int i = 0; i < results.getCount(); i++) {
+            NimBLEAdvertisedDevice device = results.getDevice(i);
+            if (!device.isAdvertisingService(NimBLEUUID((uint16_t)HID_SERVICE_UUID))) {
+                continue;
+            }
+            uint16_t appearance = device.haveAppearance() ? device.getAppearance() : 0;
+            if (appearance != 0 && appearance != APPEARANCE_GAMEPAD && appearance != APPEARANCE_JOYSTICK) {
+                continue;
+            }
+            if (connectTo(device.getAddress())) {
+                break;
+            }
+        }
+        scan->clearResults();
+    }
+}
+
+bool BLEGamepadController::connectTo(const NimBLEAddress& address) {
+    // Fields this gamepad has not sent yet start from rest, not from the last link
+    memset(&latestReport, 0, sizeof(latestReport));
+    
+    // Ask for the minimum interval up front; gamepads may renegotiate later
+    client->setConnectionParams(BLE_CONN_INTERVAL, BLE_CONN_INTERVAL, 0, BLE_SUPERVISION_TIMEOUT);
+    if (!client->connect(address)) {
+        return false;
+    }
+    
+    client->secureConnection();
+    if (!setupHid()) {
+        LOG_W(LOG_INPUT, "%s has no usable HID reports", address.toString().c_str());
+        client->disconnect();
+        return false;
+    }
+    
+    client->updateConnParams(BLE_CONN_INTERVAL, BLE_CONN_INTERVAL, 0, BLE_SUPERVISION_TIMEOUT);
+    linkUp = true;
+    LOG_I(LOG_INPUT, "BLE gamepad %s connected, %u fields, interval %u x 1.25 ms",
+          address.toString().c_str(), reportMap.getFieldCount(), client->getConnInfo().getConnInterval());
+    return true;
+}
+
+bool BLEGamepadController::setupHid() {
+    NimBLERemoteService* hid = client->getService(NimBLEUUID((uint16_t)HID_SERVICE_UUID));
+    if (hid == nullptr) {
+        return false;
+    }
+    
+    // The descriptor is read and parsed once per connection
+    NimBLERemoteCharacteristic* reportMapChr = hid->getCharacteristic(NimBLEUUID((uint16_t)HID_REPORT_MAP_UUID));
+    if (reportMapChr == nullptr) {
+        return false;
+    }
+    std::string descriptor = reportMapChr->readValue();
+    if (reportMap.parse((const uint8_t*)descriptor.data(), descriptor.size()) == 0) {
+        return false;
+    }
+    
+    // Follow every input report, remembering its report ID by handle
+    reportSlotCount = 0;
+    std::vector<NimBLERemoteCharacteristic*>* characteristics = hid->getCharacteristics(true);
+    for (NimBLERemoteCharacteristic* characteristic : *characteristics) {
+        if (reportSlotCount >= BLE_MAX_REPORTS) {
+            break;
+        }
+        if (characteristic->getUUID() != NimBLEUUID((uint16_t)HID_REPORT_UUID) || !characteristic->canNotify()) {
+            continue;
+        }
+        
+        uint8_t reportId = 0;
+        NimBLERemoteDescriptor* reference = characteristic->getDescriptor(NimBLEUUID((uint16_t)HID_REPORT_REFERENCE_UUID));
+        if (reference != nullptr) {
+            std::string value = reference->readValue();
+            if (value.size() >= 2 && value[1] != 1) {
+                continue;  // Output or feature report
+            }
+            if (value.size() >= 1) {
+                reportId = value[0];
+            }
+        }
+        
+        reportSlots[reportSlotCount].handle = characteristic->getHandle();
+        reportSlots[reportSlotCount].reportId = reportId;
+        reportSlotCount++;
+        characteristic->subscribe(true, onNotify);
+    }
+    
+    return reportSlotCount > 0;
+}
+
+void BLEGamepadController::onNotify(NimBLERemoteCharacteristic* characteristic, uint8_t* data, size_t length, bool isNotify) {
+    uint16_t handle = characteristic->getHandle();
+    for (int i = 0; i < reportSlotCount; i++) {
+        if (reportSlots[i].handle != handle) {
+            continue;
+        }
+        
+        // Fields this report does not carry keep their last value
+        PS5Report report = latestReport;
+        if (!reportMap.decode(reportSlots[i].reportId, data, length, report)) {
+            return;
+        }
+        uint32_t nowUs = micros();
+        report.timeMs = millis();
+        latestReport = report;
+        bool queued = reports.push(report);
+        
+        portENTER_CRITICAL(&meterLock);
+        meter.record(nowUs);
+        if (!queued) {
+            meter.recordOverflow();
+        }
+        portEXIT_CRITICAL(&meterLock);
+        return;
+    }
+}
+
+void BLEGamepadController::LinkCallbacks::onDisconnect(NimBLEClient* client) {
+    linkUp = false;
+}
+
+bool BLEGamepadController::LinkCallbacks::onConnParamsUpdateRequest(NimBLEClient* client, const ble_gap_upd_params* params) {
+    // Accept, a refused update makes some gamepads drop the link
+    LOG_D(LOG_INPUT, "Gamepad asked for interval %u-%u", params->itvl_min, params->itvl_max);
+    return true;
+}
+
+void BLEGamepadController::update() {
+    bool wasConnected = connected;
+    connected = linkUp;
+    
+    // Connection state changed
+    if (connected != wasConnected) {
+        if (connected) {
+            setStatus(STATUS_CONNECTED);
+        } else {
+            setStatus(STATUS_DISCONNECTED);
+            LOG_I(LOG_INPUT, "BLE gamepad disconnected");
+            mapper.resetAllButtons();
+        }
+    }
+    
+    // Apply every queued report in order, so no press between two passes is
+    // lost; without a link they are dropped so the next link starts clean
+    PS5Report report;
+    while (reports.pop(report)) {
+        if (connected) {
+            mapper.apply(report);
+        }
+    }
+}
+
+bool BLEGamepadController::isConnected() const {
+    return connected;
+}
+
+bool BLEGamepadController::getReportStats(ReportRateStats& stats) const {
+    uint32_t nowUs = micros();
+    portENTER_CRITICAL(&meterLock);
+    meter.getStats(nowUs, stats);
+    portEXIT_CRITICAL(&meterLock);
+    return true;
+}
+
+int BLEGamepadController::getAnalogValue(int index) const {
+    return mapper.getAnalogValue(index);
+}
+
+bool BLEGamepadController::getButtonState(int index) const {
+    return mapper.getButtonState(index);
+}
+
+#endif
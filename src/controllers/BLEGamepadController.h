@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "../Config.h"
+
+#if BLE_GAMEPAD
+
+#include <NimBLEDevice.h>
+#include "Controller.h"
+#include "HidReportMap.h"
+#include "PS5InputMapper.h"
+#include "ReportQueue.h"
+
+// Input from a BLE HID-over-GATT gamepad (Xbox Series, 8BitDo and similar)
+// through NimBLE, in place of the Bluedroid Classic DualSense. A link task
+// finds and connects the gamepad at the minimum 7.5 ms interval and parses
+// its report descriptor once; notifications are decoded through that table
+// into PS5Reports, so channel mapping and gestures are shared with the PS5 path.
+class BLEGamepadController : public Controller {
+public:
+    BLEGamepadController(ChannelManager* channelManager);
+    ~BLEGamepadController() override = default;
+    
+    // Start NimBLE and the link task
+    bool begin() override;
+    
+    // Apply pending reports and track the link
+    void update() override;
+    
+    bool isConnected() const override;
+    int getAnalogValue(int index) const override;
+    bool getButtonState(int index) const override;
+    bool getReportStats(ReportRateStats& stats) const override;
+
+private:
+    static void linkTaskEntry(void* param);
+    void linkTask();
+    
+    // Connect, secure, parse and subscribe; false leaves the link down
+    bool connectTo(const NimBLEAddress& address);
+    bool setupHid();
+    
+    // Runs on the NimBLE host task for every input report
+    static void onNotify(NimBLERemoteCharacteristic* characteristic, uint8_t* data, size_t length, bool isNotify);
+    
+    class LinkCallbacks : public NimBLEClientCallbacks {
+        void onDisconnect(NimBLEClient* client) override;
+        bool onConnParamsUpdateRequest(NimBLEClient* client, const ble_gap_upd_params* params) override;
+    };
+    
+    // Report characteristic handle to report ID, filled in at connect
+    struct ReportSlot {
+        uint16_t handle;
+        uint8_t reportId;
+    };
+    
+    static ReportSlot reportSlots[];
+    static int reportSlotCount;
+    static HidReportMap reportMap;
+    
+    // Fields of every report ID merged (NimBLE host task only), and the
+    // reports queued for the loop task
+    static PS5Report latestReport;
+    static ReportQueue reports;
+    static portMUX_TYPE meterLock;
+    static ReportRateMeter meter;
+    static volatile bool linkUp;
+    
+    LinkCallbacks linkCallbacks;
+    NimBLEClient* client;
+    TaskHandle_t linkTaskHandle;
+    PS5InputMapper mapper;
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BondTable.h"
+#include "../utils/ConfigStore.h"
+#include "../utils/Log.h"
+#include "../utils/Utils.h"
+
+BondTable::BondTable() {
+    memset(&list, 0, sizeof(list));
+}
+
+void BondTable::load() {
+    const ConfigData& config = ConfigStore::get();
+    if (config.bonds.count > 0 && config.bonds.count <= BOND_TABLE_SIZE) {
+        list = config.bonds;
+        LOG_I(LOG_INPUT, "Loaded %u bonded controllers", list.count);
+    } else if (config.lastMac[0] != '\0') {
+        // A MAC saved by firmware from before the bond table
+        add(config.lastMac);
+        save();
+        LOG_I(LOG_INPUT, "Migrated saved MAC %s to the bond table", config.lastMac);
+    }
+}
+
+void BondTable::save() const {
+    ConfigStore::setBonds(list);
+}
+
+int BondTable::getCount() const {
+    return list.count;
+}
+
+const BondEntry& BondTable::get(int slot) const {
+    return list.entries[slot];
+}
+
+BondEntry& BondTable::get(int slot) {
+    return list.entries[slot];
+}
+
+int BondTable::find(const char* mac) const {
+    uint8_t address[6];
+    return parseMac(mac, address) ? findMac(address) : -1;
+}
+
+int BondTable::findMac(const uint8_t mac[6]) const {
+    for (int i = 0; i < list.count; i++) {
+        if (memcmp(list.entries[i].mac, mac, 6) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int BondTable::add(const char* mac) {
+    uint8_t address[6];
+    if (!parseMac(mac, address)) {
+        return -1;
+    }
+    
+    int slot = findMac(address);
+    if (slot >= 0) {
+        return touch(slot);
+    }
+    
+    // New bond goes in front, the last one falls off a full table
+    int keep = min((int)list.count, BOND_TABLE_SIZE - 1);
+    memmove(&list.entries[1], &list.entries[0], keep * sizeof(BondEntry));
+    list.count = keep + 1;
+    
+    BondEntry& entry = list.entries[0];
+    memcpy(entry.mac, address, 6);
+    snprintf(entry.label, sizeof(entry.label), "DualSense %02X%02X", address[4], address[5]);
+    entry.profile = PS5InputMapper::getDefaultProfile();
+    return 0;
+}
+
+int BondTable::touch(int slot) {
+    if (slot > 0) {
+        BondEntry entry = list.entries[slot];
+        memmove(&list.entries[1], &list.entries[0], slot * sizeof(BondEntry));
+        list.entries[0] = entry;
+    }
+    return 0;
+}
+
+bool BondTable::remove(const char* mac) {
+    int slot = find(mac);
+    if (slot < 0) {
+        return false;
+    }
+    memmove(&list.entries[slot], &list.entries[slot + 1], (list.count - slot - 1) * sizeof(BondEntry));
+    list.count--;
+    return true;
+}
+
+void BondTable::formatMac(const uint8_t mac[6], char* out) {
+    snprintf(out, 18, "%02x:%02x:%02x:%02x:%02x:%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include "PS5InputMapper.h"
+#include "../Config.h"
+
+// One bonded controller
+struct BondEntry {
+    uint8_t mac[6];
+    char label[BOND_LABEL_SIZE];
+    ControllerProfile profile;
+};
+
+// Bonds as kept in the config store
+struct BondList {
+    uint8_t count;
+    BondEntry entries[BOND_TABLE_SIZE];
+};
+
+// Controllers this bridge has connected to, most recently used first, kept in
+// the config store. Lookups scan at most BOND_TABLE_SIZE entries and a slot
+// hands out its profile directly.
+class BondTable {
+public:
+    BondTable();
+    
+    // Take the table from the config store; without bonds, the last-used MAC becomes slot 0
+    void load();
+    
+    // Hand the table to the config store, which writes it back in the background
+    void save() const;
+    
+    int getCount() const;
+    const BondEntry& get(int slot) const;
+    BondEntry& get(int slot);
+    
+    // Slot of a controller, -1 when it is not bonded
+    int find(const char* mac) const;
+    
+    // Bond a controller with the default profile (or keep its existing one) and
+    // move it to slot 0; a full table drops the least recently used bond
+    int add(const char* mac);
+    
+    // Move a bond to slot 0 and return its new slot
+    int touch(int slot);
+    
+    // Forget a controller, false if it was not bonded
+    bool remove(const char* mac);
+    
+    // "xx:xx:xx:xx:xx:xx", out holds 18 bytes
+    static void formatMac(const uint8_t mac[6], char* out);
+
+private:
+    int findMac(const uint8_t mac[6]) const;
+    
+    BondList list;
+};
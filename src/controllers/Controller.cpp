@@ -23,7 +23,41 @@
 
 #include "Controller.h"
 
+// Indexed by ControllerStatus
+static const char* const statusTexts[STATUS_COUNT] = {
+    "WAITING",
+    "NO MAC",
+    "CONNECTED",
+    "DISCONNECTED",
+    "RECONNECTING"
+};
+
+const char* getStatusText(ControllerStatus status) {
+    return status < STATUS_COUNT ? statusTexts[status] : "";
+}
+
 Controller::Controller(ChannelManager* channelManager) : 
     channelManager(channelManager),
-    connected(false) {
+    connected(false),
+    status(STATUS_WAITING),
+    statusGeneration(0) {
+}
+
+ControllerStatus Controller::getStatus() const {
+    return status;
+}
+
+uint32_t Controller::getStatusGeneration() const {
+    return statusGeneration;
+}
+
+bool Controller::getReportStats(ReportRateStats& stats) const {
+    return false;
+}
+
+void Controller::setStatus(ControllerStatus newStatus) {
+    if (newStatus != status) {
+        status = newStatus;
+        statusGeneration++;
+    }
 } 
\ No newline at end of file
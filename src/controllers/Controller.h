@@ -24,6 +24,20 @@
 #pragma once
 
 #include "../channels/ChannelManager.h"
+#include "ReportRateMeter.h"
+
+// Connection status shown on the status screen
+enum ControllerStatus : uint8_t {
+    STATUS_WAITING = 0,
+    STATUS_NO_MAC,
+    STATUS_CONNECTED,
+    STATUS_DISCONNECTED,
+    STATUS_RECONNECTING,
+    STATUS_COUNT
+};
+
+// Display text for a status, from a constant table
+const char* getStatusText(ControllerStatus status);
 
 // Abstract base class for all controllers
 class Controller {
@@ -40,16 +54,27 @@ public:
     // Check if controller is connected
     virtual bool isConnected() const = 0;
     
-    // Get connection status message
-    virtual const char* getStatusMessage() const = 0;
+    // Get connection status
+    ControllerStatus getStatus() const;
+    
+    // Incremented on every status change, so readers can skip unchanged status
+    uint32_t getStatusGeneration() const;
     
     // Get analog value for display and debugging
     virtual int getAnalogValue(int index) const = 0;
     
     // Get button state for display and debugging
     virtual bool getButtonState(int index) const = 0;
+    
+    // Report arrival statistics of the input link, false when it is not metered
+    virtual bool getReportStats(ReportRateStats& stats) const;
 
 protected:
+    // Change the status, bumping the generation only on a real change
+    void setStatus(ControllerStatus newStatus);
+    
     ChannelManager* channelManager;
     bool connected;
+    ControllerStatus status;
+    uint32_t statusGeneration;
 }; 
\ No newline at end of file
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "HidReportMap.h"
+#include <string.h>
+
+// Usage pages and usages the gamepads use
+#define HID_PAGE_GENERIC_DESKTOP 0x01
+#define HID_PAGE_SIMULATION 0x02
+#define HID_PAGE_BUTTON 0x09
+
+#define HID_USAGE_X 0x30
+#define HID_USAGE_Y 0x31
+#define HID_USAGE_Z 0x32
+#define HID_USAGE_RX 0x33
+#define HID_USAGE_RY 0x34
+#define HID_USAGE_RZ 0x35
+#define HID_USAGE_HAT 0x39
+#define HID_USAGE_ACCELERATOR 0xC4
+#define HID_USAGE_BRAKE 0xC5
+
+// Most report IDs a descriptor may use before further ones are ignored
+#define HID_MAX_REPORT_IDS 8
+
+// Usages remembered between main items
+#define HID_MAX_USAGES 16
+
+// Button usage 1-16 to PS5Button, Xbox Series / XInput-style layout
+static const int8_t buttonUsageMap[16] = {
+    BUTTON_CROSS,     // 1  A
+    BUTTON_CIRCLE,    // 2  B
+    -1,               // 3
+    BUTTON_SQUARE,    // 4  X
+    BUTTON_TRIANGLE,  // 5  Y
+    -1,               // 6
+    BUTTON_L1,        // 7  LB
+    BUTTON_R1,        // 8  RB
+    -1,               // 9
+    -1,               // 10
+    BUTTON_CREATE,    // 11 View
+    BUTTON_OPTIONS,   // 12 Menu
+    BUTTON_PS,        // 13 Home
+    BUTTON_L3,        // 14 Left stick
+    BUTTON_R3,        // 15 Right stick
+    -1,               // 16
+};
+
+// Hat switch position 0-7 (N, NE, E ... NW) to D-pad buttons
+static const uint32_t hatButtons[8] = {
+    PS5_BUTTON_BIT(BUTTON_UP),
+    PS5_BUTTON_BIT(BUTTON_UP) | PS5_BUTTON_BIT(BUTTON_RIGHT),
+    PS5_BUTTON_BIT(BUTTON_RIGHT),
+    PS5_BUTTON_BIT(BUTTON_DOWN) | PS5_BUTTON_BIT(BUTTON_RIGHT),
+    PS5_BUTTON_BIT(BUTTON_DOWN),
+    PS5_BUTTON_BIT(BUTTON_DOWN) | PS5_BUTTON_BIT(BUTTON_LEFT),
+    PS5_BUTTON_BIT(BUTTON_LEFT),
+    PS5_BUTTON_BIT(BUTTON_UP) | PS5_BUTTON_BIT(BUTTON_LEFT),
+};
+
+static int32_t clampValue(int32_t value, int32_t low, int32_t high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+HidReportMap::HidReportMap() : fieldCount(0) {
+}
+
+int HidReportMap::targetFor(uint16_t usagePage, uint16_t usage) {
+    if (usagePage == HID_PAGE_GENERIC_DESKTOP) {
+        switch (usage) {
+            case HID_USAGE_X: return HID_TARGET_LEFT_X;
+            case HID_USAGE_Y: return HID_TARGET_LEFT_Y;
+            case HID_USAGE_Z: return HID_TARGET_RIGHT_X;
+            case HID_USAGE_RZ: return HID_TARGET_RIGHT_Y;
+            case HID_USAGE_RX: return HID_TARGET_RIGHT_X;
+            case HID_USAGE_RY: return HID_TARGET_RIGHT_Y;
+            case HID_USAGE_HAT: return HID_TARGET_HAT;
+        }
+    } else if (usagePage == HID_PAGE_SIMULATION) {
+        switch (usage) {
+            case HID_USAGE_BRAKE: return HID_TARGET_L2;
+            case HID_USAGE_ACCELERATOR: return HID_TARGET_R2;
+        }
+    } else if (usagePage == HID_PAGE_BUTTON) {
+        if (usage >= 1 && usage <= 16 && buttonUsageMap[usage - 1] >= 0) {
+            return HID_TARGET_BUTTON + buttonUsageMap[usage - 1];
+        }
+    }
+    return -1;
+}
+
+int HidReportMap::parse(const uint8_t* descriptor, size_t length) {
+    // Global state
+    uint16_t usagePage = 0;
+    int32_t logicalMin = 0;
+    int32_t logicalMax = 0;
+    uint8_t reportSize = 0;
+    uint8_t reportCount = 0;
+    uint8_t reportId = 0;
+    
+    // Local state, cleared after every main item
+    uint32_t usages[HID_MAX_USAGES];
+    int usageCount = 0;
+    uint32_t usageMin = 0;
+    uint32_t usageMax = 0;
+    
+    // Bit position within each report ID
+    uint8_t offsetIds[HID_MAX_REPORT_IDS];
+    uint16_t offsetBits[HID_MAX_REPORT_IDS];
+    int offsetCount = 1;
+    int offsetIndex = 0;
+    offsetIds[0] = 0;
+    offsetBits[0] = 0;
+    
+    fieldCount = 0;
+    size_t pos = 0;
+    while (pos < length) {
+        uint8_t prefix = descriptor[pos++];
+        
+        // Long items carry nothing a gamepad needs
+        if (prefix == 0xFE) {
+            if (pos + 1 >= length) {
+                break;
+            }
+            pos += 2 + descriptor[pos];
+            continue;
+        }
+        
+        uint8_t size = prefix & 0x03;
+        if (size == 3) {
+            size = 4;
+        }
+        if (pos + size > length) {
+            break;
+        }
+        
+        uint32_t value = 0;
+        for (int i = 0; i < size; i++) {
+            value |= (uint32_t)descriptor[pos + i] << (8 * i);
+        }
+        int32_t signedValue = value;
+        if (size == 1) {
+            signedValue = (int8_t)value;
+        } else if (size == 2) {
+            signedValue = (int16_t)value;
+        }
+        pos += size;
+        
+        switch (prefix & 0xFC) {
+            // Global items
+            case 0x04: usagePage = value; break;
+            case 0x14: logicalMin = signedValue; break;
+            case 0x24: logicalMax = (logicalMin < 0) ? signedValue : (int32_t)value; break;
+            case 0x74: reportSize = value; break;
+            case 0x94: reportCount = value; break;
+            case 0x84: {
+                reportId = value;
+                offsetIndex = -1;
+                for (int i = 0; i < offsetCount; i++) {
+                    if (offsetIds[i] == reportId) {
+                        offsetIndex = i;
+                    }
+                }
+                if (offsetIndex < 0 && offsetCount < HID_MAX_REPORT_IDS) {
+                    offsetIndex = offsetCount++;
+                    offsetIds[offsetIndex] = reportId;
+                    offsetBits[offsetIndex] = 0;
+                }
+                break;
+            }
+            
+            // Local items; 4-byte usages carry their own page in the top half
+            case 0x08:
+                if (usageCount < HID_MAX_USAGES) {
+                    usages[usageCount++] = (size == 4) ? value : ((uint32_t)usagePage << 16) | value;
+                }
+                break;
+            case 0x18: usageMin = (size == 4) ? value : ((uint32_t)usagePage << 16) | value; break;
+            case 0x28: usageMax = (size == 4) ? value : ((uint32_t)usagePage << 16) | value; break;
+            
+            // Input main item: one field per variable element with a known usage
+            case 0x80: {
+                bool isConstant = value & 0x01;
+                bool isVariable = value & 0x02;
+                for (int i = 0; i < reportCount; i++) {
+                    uint32_t usage = 0;
+                    if (usageCount > 0) {
+                        usage = usages[i < usageCount ? i : usageCount - 1];
+                    } else if (usageMin != 0 || usageMax != 0) {
+                        usage = (usageMin + i < usageMax) ? usageMin + i : usageMax;
+                    }
+                    
+                    int target = -1;
+                    if (!isConstant && isVariable && usage != 0) {
+                        target = targetFor(usage >> 16, usage & 0xFFFF);
+                    }
+                    
+                    if (target >= 0 && offsetIndex >= 0 && fieldCount < HID_MAX_FIELDS) {
+                        HidField& field = fields[fieldCount++];
+                        field.reportId = reportId;
+                        field.target = target;
+                        field.bitSize = reportSize;
+                        field.bitOffset = offsetBits[offsetIndex] + i * reportSize;
+                        field.logicalMin = logicalMin;
+                        field.logicalMax = logicalMax;
+                    }
+                }
+                if (offsetIndex >= 0) {
+                    offsetBits[offsetIndex] += reportSize * reportCount;
+                }
+                usageCount = 0;
+                usageMin = usageMax = 0;
+                break;
+            }
+            
+            // Other main items (output, feature, collections) only end the local state
+            case 0x90:
+            case 0xB0:
+            case 0xA0:
+            case 0xC0:
+                usageCount = 0;
+                usageMin = usageMax = 0;
+                break;
+        }
+    }
+    
+    return fieldCount;
+}
+
+int32_t HidReportMap::extract(const uint8_t* data, size_t length, uint16_t bitOffset, uint8_t bitSize, bool isSigned) {
+    // A zero-size field carries nothing (and has no sign bit)
+    if (bitSize == 0) {
+        return 0;
+    }
+    
+    uint32_t value = 0;
+    for (int bit = 0; bit < bitSize && bit < 32; bit++) {
+        size_t index = (bitOffset + bit) >> 3;
+        if (index >= length) {
+            break;
+        }
+        if (data[index] & (1 << ((bitOffset + bit) & 7))) {
+            value |= 1UL << bit;
+        }
+    }
+    
+    if (isSigned && bitSize < 32 && (value & (1UL << (bitSize - 1)))) {
+        value |= ~0UL << bitSize;
+    }
+    return (int32_t)value;
+}
+
+bool HidReportMap::decode(uint8_t reportId, const uint8_t* data, size_t length, PS5Report& report) const {
+    bool found = false;
+    
+    // Buttons this report ID carries, and which of them are down; buttons
+    // that live in other reports keep their state
+    uint32_t carried = 0;
+    uint32_t pressed = 0;
+    
+    for (int i = 0; i < fieldCount; i++) {
+        const HidField& field = fields[i];
+        if (field.reportId != reportId) {
+            continue;
+        }
+        found = true;
+        
+        int32_t raw = extract(data, length, field.bitOffset, field.bitSize, field.logicalMin < 0);
+        int32_t range = field.logicalMax - field.logicalMin;
+        
+        switch (field.target) {
+            case HID_TARGET_LEFT_X:
+            case HID_TARGET_RIGHT_X:
+            case HID_TARGET_LEFT_Y:
+            case HID_TARGET_RIGHT_Y: {
+                // Scale to -128..127; HID Y grows downwards, the DualSense's upwards
+                int32_t scaled = range > 0 ? (int64_t)(raw - field.logicalMin) * 255 / range - 128 : 0;
+                if (field.target == HID_TARGET_LEFT_Y || field.target == HID_TARGET_RIGHT_Y) {
+                    scaled = -1 - scaled;
+                }
+                int8_t value = clampValue(scaled, -128, 127);
+                if (field.target == HID_TARGET_LEFT_X) report.leftX = value;
+                else if (field.target == HID_TARGET_LEFT_Y) report.leftY = value;
+                else if (field.target == HID_TARGET_RIGHT_X) report.rightX = value;
+                else report.rightY = value;
+                break;
+            }
+            
+            case HID_TARGET_L2:
+            case HID_TARGET_R2: {
+                int32_t scaled = range > 0 ? (int64_t)(raw - field.logicalMin) * 255 / range : 0;
+                uint8_t value = clampValue(scaled, 0, 255);
+                if (field.target == HID_TARGET_L2) report.l2 = value;
+                else report.r2 = value;
+                break;
+            }
+            
+            case HID_TARGET_HAT: {
+                // Out-of-range values mean centered
+                int32_t position = raw - field.logicalMin;
+                carried |= PS5_BUTTON_BIT(BUTTON_UP) | PS5_BUTTON_BIT(BUTTON_DOWN) |
+                           PS5_BUTTON_BIT(BUTTON_LEFT) | PS5_BUTTON_BIT(BUTTON_RIGHT);
+                if (position >= 0 && position < 8 && raw <= field.logicalMax) {
+                    pressed |= hatButtons[position];
+                }
+                break;
+            }
+            
+            default: {
+                uint32_t bit = PS5_BUTTON_BIT(field.target - HID_TARGET_BUTTON);
+                carried |= bit;
+                if (raw != 0) {
+                    pressed |= bit;
+                }
+                break;
+            }
+        }
+    }
+    
+    report.buttons = (report.buttons & ~carried) | pressed;
+    return found;
+}
+
+int HidReportMap::getFieldCount() const {
+    return fieldCount;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "PS5Report.h"
+#include "../Config.h"
+
+// What a descriptor field drives in a PS5Report
+enum HidTarget : uint8_t {
+    HID_TARGET_LEFT_X = 0,
+    HID_TARGET_LEFT_Y,
+    HID_TARGET_RIGHT_X,
+    HID_TARGET_RIGHT_Y,
+    HID_TARGET_L2,
+    HID_TARGET_R2,
+    HID_TARGET_HAT,
+    HID_TARGET_BUTTON    // + PS5Button
+};
+
+// One input field located by the descriptor parser
+struct HidField {
+    uint8_t reportId;    // 0 when the descriptor has no report IDs
+    uint8_t target;      // HidTarget
+    uint8_t bitSize;
+    uint16_t bitOffset;  // From the first byte after the report ID
+    int32_t logicalMin;
+    int32_t logicalMax;
+};
+
+// Input layout of a HID gamepad. The report descriptor is parsed once at
+// connect into a flat field table; decoding a report then only walks that
+// table, extracting bits and scaling them into a PS5Report, so the same
+// mapping, gestures and channel code serve BLE gamepads and the DualSense.
+class HidReportMap {
+public:
+    HidReportMap();
+    
+    // Parse a report descriptor, returns the number of fields found
+    int parse(const uint8_t* descriptor, size_t length);
+    
+    // Decode one input report (without its report ID byte) into report. Only
+    // the axes and buttons this report ID carries change, so reports split
+    // across IDs merge; false if the map has no fields for this report ID
+    bool decode(uint8_t reportId, const uint8_t* data, size_t length, PS5Report& report) const;
+    
+    int getFieldCount() const;
+
+private:
+    // Target of a usage, or -1 when it is not mapped
+    static int targetFor(uint16_t usagePage, uint16_t usage);
+    
+    static int32_t extract(const uint8_t* data, size_t length, uint16_t bitOffset, uint8_t bitSize, bool isSigned);
+    
+    HidField fields[HID_MAX_FIELDS];
+    int fieldCount;
+};
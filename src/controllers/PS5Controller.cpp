@@ -22,253 +22,381 @@
 
 
 #include "PS5Controller.h"
+#include "../utils/Log.h"
 #include "../Config.h"
-#include "../utils/Utils.h"
-#include <Preferences.h>
+#include "../utils/ConfigStore.h"
+#include "../utils/BootTimeline.h"
+#include "../utils/BluetoothLock.h"
 
 PS5Controller::PS5Controller(ChannelManager* channelManager) : 
     Controller(channelManager),
-    btnL1("L1", 2),
-    btnR1("R1", 3),
-    btnCross("Cross", 0),
-    btnCircle("Circle", 0),
-    btnSquare("Square", 0),
-    btnTriangle("Triangle", 0),
-    btnUp("Up", 0),
-    btnDown("Down", 0),
-    btnLeft("Left", 0),
-    btnRight("Right", 0),
-    btnL3("L3", 0),
-    btnR3("R3", 0) {
+    rotateSlot(0),
+    targetSince(0),
+    rotationHeld(false),
+    requestedAt(0),
+    connectRequested(false),
+    forgetRequested(false),
+    connectStartTime(0),
+    connectTimed(false),
+    requestLock(portMUX_INITIALIZER_UNLOCKED),
+    linkTaskHandle(nullptr),
+    retargetPending(false),
+    endPending(false),
+    inputSource(&liveSource),
+    mapper(channelManager) {
     
-    statusMessage = "WAITING";
-    leftX = leftY = rightX = rightY = 0;
-    l2Value = r2Value = 0;
-    
-    // Load MAC address from preferences or set initial state
-    loadMacFromPreferences();
+    requestedMac[0] = '\0';
+    forgetMac[0] = '\0';
+    targetMac[0] = '\0';
 }
 
 bool PS5Controller::begin() {
-    // Force reload MAC address from preferences to ensure we have the latest
-    loadMacFromPreferences();
+    // Settings are in RAM by now (ConfigStore::begin() in setup)
+    loadSavedMac();
+    
+    // Bonded controllers; without a last-used MAC start with the most recent bond
+    bonds.load();
+    if (macAddress.length() == 0 && bonds.getCount() > 0) {
+        char mac[18];
+        BondTable::formatMac(bonds.get(0).mac, mac);
+        macAddress = mac;
+    }
+    
+    // Timestamp reports as they arrive from the ps5 library
+    liveSource.begin();
+    
+    // Library restarts take hundreds of milliseconds, keep them off the loop task
+    if (linkTaskHandle == nullptr &&
+        xTaskCreatePinnedToCore(linkTaskEntry, "btlink", 4096, this, 1, &linkTaskHandle, 0) != pdPASS) {
+        LOG_E(LOG_INPUT, "Failed to start Bluetooth link task, restarting inline");
+        linkTaskHandle = nullptr;
+    }
     
     // Only attempt to connect if we have a MAC address
     if (macAddress.length() > 0) {
         // Initialize PS5 controller with the current MAC address
-        ps5.begin(macAddress.c_str());
-        Serial.println("PS5 Controller initialized, waiting for connection with MAC: " + macAddress);
-        statusMessage = "WAITING";
+        retarget(macAddress.c_str());
+        reconnectEngine.setTarget(macAddress.c_str());
+        rotateSlot = 0;
+        LOG_I(LOG_INPUT, "PS5 Controller initialized, waiting for connection with MAC: %s", macAddress.c_str());
+        setStatus(STATUS_WAITING);
         return true;
     } else {
-        Serial.println("No MAC address set, please select a device from the connection screen");
-        statusMessage = "NO MAC";
+        LOG_W(LOG_INPUT, "No MAC address set, please select a device from the connection screen");
+        setStatus(STATUS_NO_MAC);
         return false;
     }
 }
 
 void PS5Controller::update() {
+    // Connections requested from the UI task run here, next to the input path
+    if (connectRequested) {
+        char mac[sizeof(requestedMac)];
+        portENTER_CRITICAL(&requestLock);
+        memcpy(mac, requestedMac, sizeof(mac));
+        connectStartTime = requestedAt;
+        connectRequested = false;
+        portEXIT_CRITICAL(&requestLock);
+        connectTimed = true;
+        
+        setMacAddress(mac);
+        reconnect();
+    }
+    
+    if (forgetRequested) {
+        char mac[sizeof(forgetMac)];
+        portENTER_CRITICAL(&requestLock);
+        memcpy(mac, forgetMac, sizeof(mac));
+        forgetRequested = false;
+        portEXIT_CRITICAL(&requestLock);
+        
+        if (bonds.remove(mac)) {
+            bonds.save();
+            LOG_I(LOG_INPUT, "Forgot controller %s", mac);
+        }
+    }
+    
     bool wasConnected = connected;
-    connected = ps5.isConnected();
+    connected = inputSource->isConnected();
     
     // Connection state changed
     if (connected != wasConnected) {
         if (connected) {
-            statusMessage = "CONNECTED";
-            Serial.println("PS5 Controller connected");
+            setStatus(STATUS_CONNECTED);
+            LOG_I(LOG_INPUT, "PS5 Controller connected");
+            applyBond();
+            
+            // Time-to-connected of a connection picked on the connection screen
+            if (connectTimed) {
+                LOG_I(LOG_INPUT, "Connected %lu ms after the request", millis() - connectStartTime);
+                connectTimed = false;
+            }
         } else {
-            statusMessage = "DISCONNECTED";
-            Serial.println("PS5 Controller disconnected");
+            setStatus(STATUS_DISCONNECTED);
+            LOG_I(LOG_INPUT, "PS5 Controller disconnected");
             resetAllButtons();
         }
     }
     
-    // Only update values when connected
-    if (connected) {
-        // Get analog inputs
-        leftX = ps5.LStickX();
-        leftY = ps5.LStickY();
-        rightX = ps5.RStickX();
-        rightY = ps5.RStickY();
-        l2Value = ps5.L2Value();
-        r2Value = ps5.R2Value();
+    // Apply every pending report in order while connected. Without a link
+    // the queue is emptied instead: a report from before a dropout must not
+    // reach the buttons reset on reconnect, where a held toggle would read as
+    // a fresh press
+    bool gotReport = false;
+    PS5Report report;
+    while (inputSource->poll(report)) {
+        if (connected) {
+            mapper.apply(report);
+            gotReport = true;
+        }
+    }
+    
+    // Page the live controller back after a dropout; CRSF output carries on meanwhile
+    if (inputSource == &liveSource) {
+        ReconnectState before = reconnectEngine.getState();
+        reconnectEngine.update(connected, gotReport, millis());
+        if (reconnectEngine.getState() == RECONNECT_PAGING && before != RECONNECT_PAGING) {
+            setStatus(STATUS_RECONNECTING);
+        }
         
-        // Update button states
-        btnL1.update(ps5.L1());
-        btnR1.update(ps5.R1());
-        btnCross.update(ps5.Cross());
-        btnCircle.update(ps5.Circle());
-        btnSquare.update(ps5.Square());
-        btnTriangle.update(ps5.Triangle());
-        btnUp.update(ps5.Up());
-        btnDown.update(ps5.Down());
-        btnLeft.update(ps5.Left());
-        btnRight.update(ps5.Right());
-        btnL3.update(ps5.L3());
-        btnR3.update(ps5.R3());
+        // With several bonds, give each a turn until one of them connects.
+        // Not while the connection screen holds it, and not away from a
+        // controller just picked there; the dwell starts over afterwards
+        if (rotationHeld || connectRequested || connectTimed) {
+            targetSince = millis();
+        } else if (!connected && bonds.getCount() > 1 && millis() - targetSince >= BOND_ROTATE_DWELL_MS) {
+            rotateBond();
+        }
+    }
+}
+
+void PS5Controller::retarget(const char* mac) {
+    portENTER_CRITICAL(&requestLock);
+    strncpy(targetMac, mac, sizeof(targetMac) - 1);
+    targetMac[sizeof(targetMac) - 1] = '\0';
+    endPending = endPending || connected;
+    retargetPending = true;
+    portEXIT_CRITICAL(&requestLock);
+    
+    // Disconnect if already connected
+    if (connected) {
+        connected = false;
+        setStatus(STATUS_DISCONNECTED);
+    }
+    
+    if (linkTaskHandle != nullptr) {
+        xTaskNotifyGive(linkTaskHandle);
+    } else {
+        runRetarget();
+    }
+    activeMac = mac;
+    targetSince = millis();
+}
+
+void PS5Controller::linkTaskEntry(void* param) {
+    static_cast<PS5Controller*>(param)->linkTask();
+}
+
+void PS5Controller::linkTask() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        runRetarget();
+    }
+}
+
+void PS5Controller::runRetarget() {
+    // Only the latest target matters if several were queued meanwhile
+    while (retargetPending) {
+        char mac[sizeof(targetMac)];
+        portENTER_CRITICAL(&requestLock);
+        memcpy(mac, targetMac, sizeof(mac));
+        bool endFirst = endPending;
+        retargetPending = false;
+        endPending = false;
+        portEXIT_CRITICAL(&requestLock);
         
-        // Map controller values to channels
-        mapControllerToChannels();
+        // A scan started from the connection screen waits for the restart
+        unsigned long start = millis();
+        BluetoothLock::take();
+        if (endFirst) {
+            ps5.end();
+        }
+        ps5.begin(mac);
+        BluetoothLock::give();
+        BootTimeline::mark(BOOT_BT_STARTED);
+        LOG_D(LOG_INPUT, "ps5 library targeting %s after %lu ms", mac, millis() - start);
     }
 }
 
-bool PS5Controller::isConnected() const {
-    return connected;
+void PS5Controller::rotateBond() {
+    rotateSlot = (rotateSlot + 1) % bonds.getCount();
+    
+    char mac[18];
+    BondTable::formatMac(bonds.get(rotateSlot).mac, mac);
+    retarget(mac);
+    reconnectEngine.retarget(mac);
+    LOG_D(LOG_INPUT, "Waiting for %s (%s)", bonds.get(rotateSlot).label, mac);
+}
+
+void PS5Controller::applyBond() {
+    int slot = bonds.find(activeMac.c_str());
+    if (slot < 0) {
+        mapper.loadProfile(PS5InputMapper::getDefaultProfile());
+        return;
+    }
+    
+    // The profile is a copy out of the slot, no lookups
+    mapper.loadProfile(bonds.get(slot).profile);
+    LOG_I(LOG_INPUT, "%s connected, profile loaded", bonds.get(slot).label);
+    
+    // Most recently used first, and the next boot starts with this controller
+    if (slot > 0) {
+        bonds.touch(slot);
+        bonds.save();
+    }
+    rotateSlot = 0;
+    if (macAddress != activeMac) {
+        setMacAddress(activeMac.c_str());
+    }
 }
 
-const char* PS5Controller::getStatusMessage() const {
-    return statusMessage.c_str();
+bool PS5Controller::isConnected() const {
+    return connected;
 }
 
 int PS5Controller::getAnalogValue(int index) const {
-    switch (index) {
-        case ANALOG_LEFT_X: return leftX;
-        case ANALOG_LEFT_Y: return leftY;
-        case ANALOG_RIGHT_X: return rightX;
-        case ANALOG_RIGHT_Y: return rightY;
-        case ANALOG_L2: return l2Value;
-        case ANALOG_R2: return r2Value;
-        default: return 0;
-    }
+    return mapper.getAnalogValue(index);
 }
 
 bool PS5Controller::getButtonState(int index) const {
-    switch (index) {
-        case BUTTON_CROSS: return btnCross.getState() > 0;
-        case BUTTON_CIRCLE: return btnCircle.getState() > 0;
-        case BUTTON_SQUARE: return btnSquare.getState() > 0;
-        case BUTTON_TRIANGLE: return btnTriangle.getState() > 0;
-        case BUTTON_L1: return btnL1.getState() > 0;
-        case BUTTON_R1: return btnR1.getState() > 0;
-        case BUTTON_L3: return btnL3.getState() > 0;
-        case BUTTON_R3: return btnR3.getState() > 0;
-        case BUTTON_UP: return btnUp.getState() > 0;
-        case BUTTON_DOWN: return btnDown.getState() > 0;
-        case BUTTON_LEFT: return btnLeft.getState() > 0;
-        case BUTTON_RIGHT: return btnRight.getState() > 0;
-        default: return false;
+    return mapper.getButtonState(index);
+}
+
+bool PS5Controller::getReportStats(ReportRateStats& stats) const {
+    // Only the live link is metered, replayed reports have no arrival times
+    if (inputSource != &liveSource) {
+        return false;
     }
+    liveSource.getReportStats(stats);
+    return true;
 }
 
 void PS5Controller::setButtonConfig(PS5Button button, int numStates) {
-    switch (button) {
-        case BUTTON_CROSS: btnCross.setNumStates(numStates); break;
-        case BUTTON_CIRCLE: btnCircle.setNumStates(numStates); break;
-        case BUTTON_SQUARE: btnSquare.setNumStates(numStates); break;
-        case BUTTON_TRIANGLE: btnTriangle.setNumStates(numStates); break;
-        case BUTTON_L1: btnL1.setNumStates(numStates); break;
-        case BUTTON_R1: btnR1.setNumStates(numStates); break;
-        case BUTTON_L3: btnL3.setNumStates(numStates); break;
-        case BUTTON_R3: btnR3.setNumStates(numStates); break;
-        case BUTTON_UP: btnUp.setNumStates(numStates); break;
-        case BUTTON_DOWN: btnDown.setNumStates(numStates); break;
-        case BUTTON_LEFT: btnLeft.setNumStates(numStates); break;
-        case BUTTON_RIGHT: btnRight.setNumStates(numStates); break;
+    mapper.setButtonConfig(button, numStates);
+    
+    // The connected controller keeps the change across reconnects and boots
+    int slot = connected ? bonds.find(activeMac.c_str()) : -1;
+    if (slot >= 0) {
+        bonds.get(slot).profile = mapper.getProfile();
+        bonds.save();
     }
 }
 
-void PS5Controller::resetAllButtons() {
-    btnL1.reset();
-    btnR1.reset();
-    btnCross.reset();
-    btnCircle.reset();
-    btnSquare.reset();
-    btnTriangle.reset();
-    btnUp.reset();
-    btnDown.reset();
-    btnLeft.reset();
-    btnRight.reset();
-    btnL3.reset();
-    btnR3.reset();
+bool PS5Controller::setBondLabel(const char* mac, const char* label) {
+    int slot = bonds.find(mac);
+    if (slot < 0) {
+        return false;
+    }
+    
+    BondEntry& entry = bonds.get(slot);
+    strncpy(entry.label, label, sizeof(entry.label) - 1);
+    entry.label[sizeof(entry.label) - 1] = '\0';
+    bonds.save();
+    return true;
 }
 
-void PS5Controller::loadMacFromPreferences() {
-    // Try to load MAC from preferences
-    Preferences preferences;
-    bool prefsOpened = false;
+bool PS5Controller::setBondProfile(const char* mac, const ControllerProfile& profile) {
+    int slot = bonds.find(mac);
+    if (slot < 0) {
+        return false;
+    }
     
-    // First try read-only mode
-    prefsOpened = preferences.begin("ps5bridge", true);
+    bonds.get(slot).profile = profile;
+    bonds.save();
     
-    if (!prefsOpened) {
-        // If read-only failed, try read-write which will create the namespace
-        prefsOpened = preferences.begin("ps5bridge", false);
+    // Takes effect at once on the connected controller
+    if (connected && slot == bonds.find(activeMac.c_str())) {
+        mapper.loadProfile(profile);
     }
+    return true;
+}
+
+void PS5Controller::resetAllButtons() {
+    mapper.resetAllButtons();
+}
+
+void PS5Controller::loadSavedMac() {
+    const char* savedMac = ConfigStore::get().lastMac;
     
-    if (prefsOpened) {
-        String savedMac = preferences.getString("mac", "");
-        preferences.end();
-        
-        if (savedMac.length() > 0) {
-            macAddress = savedMac;
-            Serial.println("Loaded saved MAC address: " + macAddress);
-        } else {
-            // No saved MAC address - start with empty string to force connection screen
-            macAddress = "";
-            Serial.println("No saved MAC address, please select a device from connection screen");
-        }
+    if (savedMac[0] != '\0') {
+        macAddress = savedMac;
+        LOG_I(LOG_INPUT, "Loaded saved MAC address: %s", savedMac);
     } else {
-        // If preferences couldn't be opened at all, start with empty string
+        // No saved MAC address - start with empty string to force connection screen
         macAddress = "";
-        Serial.println("Failed to open preferences, please select a device from connection screen");
+        LOG_W(LOG_INPUT, "No saved MAC address, please select a device from connection screen");
     }
 }
 
 void PS5Controller::setMacAddress(const char* mac) {
     macAddress = mac;
     
-    // Save to preferences for persistence
-    Preferences preferences;
-    if (preferences.begin("ps5bridge", false)) {
-        preferences.putString("mac", macAddress);
-        Serial.println("Saved MAC address to preferences: " + macAddress);
-        preferences.end();
-    } else {
-        Serial.println("Failed to save MAC address to preferences");
-    }
+    // Bond it (or move it to the front) with its own profile
+    bonds.add(mac);
+    bonds.save();
+    
+    // Written back to flash by the config store
+    ConfigStore::setLastMac(mac);
+    LOG_I(LOG_INPUT, "Saved MAC address: %s", mac);
 }
 
 void PS5Controller::reconnect() {
-    // Disconnect if already connected
-    if (connected) {
-        ps5.end();
-        connected = false;
-        statusMessage = "DISCONNECTED";
+    // Same controller: keep the stack and bond, the reconnect engine pages it.
+    // It may never have linked (off at boot), so start paging here rather than
+    // waiting for a dropout that will not come
+    if (macAddress.length() > 0 && macAddress == activeMac) {
+        LOG_I(LOG_INPUT, "Already targeting %s, not restarting Bluetooth", macAddress.c_str());
+        if (!connected && inputSource == &liveSource) {
+            reconnectEngine.pageNow(connected, millis());
+            setStatus(STATUS_RECONNECTING);
+        }
+        return;
     }
     
     // Only attempt to reconnect if we have a MAC address
     if (macAddress.length() > 0) {
-        ps5.begin(macAddress.c_str());
-        statusMessage = "WAITING";
-        Serial.println("Reconnecting to PS5 controller with MAC: " + macAddress);
+        retarget(macAddress.c_str());
+        reconnectEngine.setTarget(macAddress.c_str());
+        rotateSlot = 0;
+        setStatus(STATUS_WAITING);
+        LOG_I(LOG_INPUT, "Reconnecting to PS5 controller with MAC: %s", macAddress.c_str());
     } else {
-        statusMessage = "NO MAC";
-        Serial.println("No MAC address set, cannot reconnect");
+        setStatus(STATUS_NO_MAC);
+        LOG_W(LOG_INPUT, "No MAC address set, cannot reconnect");
     }
 }
 
-void PS5Controller::mapControllerToChannels() {
-    // Map sticks to channels 0-3
-    channelManager->setChannel(0, mapValueClamped(leftX, -128, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));   // Channel 0: Left stick X
-    channelManager->setChannel(1, mapValueClamped(rightY, -128, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // Channel 1: Right stick Y
-    
-    // FIX: Left stick Y (throttle) - Only uses positive range (0 to 127) 
-    // Original mapping was treating up as max (127 → MAX) and center as min (-1 → MIN)
-    channelManager->setChannel(2, mapValueClamped(leftY, 0, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));   // Channel 2: Left stick Y
-    
-    channelManager->setChannel(3, mapValueClamped(rightX, -128, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // Channel 3: Right stick X
-    
-    // Map buttons and triggers to channels 4-15
-    channelManager->setChannel(4, btnL1.getValue());      // AUX1 (L1 button)
-    channelManager->setChannel(5, btnR1.getValue());      // AUX2 (R1 button)
-    channelManager->setChannel(6, mapValueClamped(l2Value, 0, 255, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // AUX3 (L2 trigger)
-    channelManager->setChannel(7, mapValueClamped(r2Value, 0, 255, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // AUX4 (R2 trigger)
-    channelManager->setChannel(8, btnCross.getValue());   // AUX5 (Cross)
-    channelManager->setChannel(9, btnCircle.getValue());  // AUX6 (Circle)
-    channelManager->setChannel(10, btnSquare.getValue()); // AUX7 (Square)
-    channelManager->setChannel(11, btnTriangle.getValue());// AUX8 (Triangle)
-    channelManager->setChannel(12, btnUp.getValue());     // AUX9 (Up)
-    channelManager->setChannel(13, btnDown.getValue());   // AUX10 (Down)
-    channelManager->setChannel(14, btnLeft.getValue());   // AUX11 (Left)
-    channelManager->setChannel(15, btnRight.getValue());  // AUX12 (Right)
-} 
\ No newline at end of file
+void PS5Controller::requestConnect(const char* mac, unsigned long startTime) {
+    portENTER_CRITICAL(&requestLock);
+    requestedAt = startTime;
+    strncpy(requestedMac, mac, sizeof(requestedMac) - 1);
+    requestedMac[sizeof(requestedMac) - 1] = '\0';
+    connectRequested = true;
+    portEXIT_CRITICAL(&requestLock);
+}
+
+void PS5Controller::requestForget(const char* mac) {
+    portENTER_CRITICAL(&requestLock);
+    strncpy(forgetMac, mac, sizeof(forgetMac) - 1);
+    forgetMac[sizeof(forgetMac) - 1] = '\0';
+    forgetRequested = true;
+    portEXIT_CRITICAL(&requestLock);
+}
+
+void PS5Controller::holdBondRotation(bool hold) {
+    rotationHeld = hold;
+}
+
+void PS5Controller::setInputSource(PS5InputSource* source) {
+    inputSource = (source != nullptr) ? source : &liveSource;
+}
\ No newline at end of file
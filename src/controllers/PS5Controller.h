@@ -25,33 +25,10 @@
 
 #include <ps5Controller.h>
 #include "Controller.h"
-#include "../utils/ButtonStateManager.h"
-
-// Enum for PS5 controller analog inputs
-enum PS5AnalogInput {
-    ANALOG_LEFT_X = 0,
-    ANALOG_LEFT_Y = 1,
-    ANALOG_RIGHT_X = 2,
-    ANALOG_RIGHT_Y = 3,
-    ANALOG_L2 = 4,
-    ANALOG_R2 = 5
-};
-
-// Enum for PS5 controller buttons
-enum PS5Button {
-    BUTTON_CROSS = 0,
-    BUTTON_CIRCLE = 1,
-    BUTTON_SQUARE = 2,
-    BUTTON_TRIANGLE = 3,
-    BUTTON_L1 = 4,
-    BUTTON_R1 = 5,
-    BUTTON_L3 = 6,
-    BUTTON_R3 = 7,
-    BUTTON_UP = 8,
-    BUTTON_DOWN = 9,
-    BUTTON_LEFT = 10,
-    BUTTON_RIGHT = 11
-};
+#include "PS5InputMapper.h"
+#include "PS5LiveSource.h"
+#include "ReconnectEngine.h"
+#include "BondTable.h"
 
 class PS5Controller : public Controller {
 public:
@@ -67,54 +44,100 @@ public:
     // Check if controller is connected
     bool isConnected() const override;
     
-    // Get connection status message
-    const char* getStatusMessage() const override;
-    
     // Get analog value for display and debugging
     int getAnalogValue(int index) const override;
     
     // Get button state for display and debugging
     bool getButtonState(int index) const override;
+    bool getReportStats(ReportRateStats& stats) const override;
     
-    // Set button configuration (toggle/momentary)
+    // Set button configuration (toggle/momentary); with a bonded controller
+    // connected it is saved as part of that controller's profile
     void setButtonConfig(PS5Button button, int numStates);
     
+    // Name a bonded controller, or replace its whole profile (loop task);
+    // false if the controller is not bonded
+    bool setBondLabel(const char* mac, const char* label);
+    bool setBondProfile(const char* mac, const ControllerProfile& profile);
+    
     // Reset all button states
     void resetAllButtons();
 
     // Set new MAC address and reconnect
     void setMacAddress(const char* mac);
     
-    // Reconnect using the current MAC address
+    // Reconnect using the current MAC address; the Bluetooth stack is only
+    // restarted when the address differs from the one the library targets
     void reconnect();
+    
+    // Ask the main loop to save a MAC address and reconnect to it (any task);
+    // the time from startTime (millis) to the connection is logged
+    void requestConnect(const char* mac, unsigned long startTime);
+    
+    // Ask the main loop to drop a controller from the bond table (any task)
+    void requestForget(const char* mac);
+    
+    // Keep the bond rotation on the current target, e.g. while the connection
+    // screen scans or quick-pairs (any task)
+    void holdBondRotation(bool hold);
+    
+    // Replace the ps5 library as input (nullptr restores the live source)
+    void setInputSource(PS5InputSource* source);
 
 private:
-    // Map controller inputs to channels
-    void mapControllerToChannels();
+    // Take the last-used MAC address from the config store
+    void loadSavedMac();
     
-    // Load MAC address from preferences
-    void loadMacFromPreferences();
+    // Point the ps5 library at another controller. Returns at once: the
+    // library restart runs on the link task, so CRSF output never waits on it
+    void retarget(const char* mac);
     
-    // Status
-    String statusMessage;
+    // Link task: carries out pending retargets
+    static void linkTaskEntry(void* param);
+    void linkTask();
+    void runRetarget();
+    
+    // Try the next bonded controller while none is connected
+    void rotateBond();
+    
+    // Load the profile of the controller that just connected
+    void applyBond();
     
     // MAC address
     String macAddress;
     
-    // Analog values
-    int leftX, leftY, rightX, rightY, l2Value, r2Value;
-    
-    // Button state managers
-    ButtonStateManager btnL1;
-    ButtonStateManager btnR1;
-    ButtonStateManager btnCross;
-    ButtonStateManager btnCircle;
-    ButtonStateManager btnSquare;
-    ButtonStateManager btnTriangle;
-    ButtonStateManager btnUp;
-    ButtonStateManager btnDown;
-    ButtonStateManager btnLeft;
-    ButtonStateManager btnRight;
-    ButtonStateManager btnL3;
-    ButtonStateManager btnR3;
-}; 
\ No newline at end of file
+    // Address the ps5 library was started with
+    String activeMac;
+    
+    // Pages the controller back after a dropout
+    ReconnectEngine reconnectEngine;
+    
+    // Known controllers, tried in turn until one connects
+    BondTable bonds;
+    int rotateSlot;
+    unsigned long targetSince;
+    volatile bool rotationHeld;
+    
+    // Pending requestConnect(), applied by update()
+    char requestedMac[18];
+    unsigned long requestedAt;
+    volatile bool connectRequested;
+    char forgetMac[18];
+    volatile bool forgetRequested;
+    
+    // Start of the connection being timed, valid while connectTimed
+    unsigned long connectStartTime;
+    bool connectTimed;
+    portMUX_TYPE requestLock;
+    
+    // Pending retarget(), carried out by the link task
+    TaskHandle_t linkTaskHandle;
+    char targetMac[18];
+    volatile bool retargetPending;
+    volatile bool endPending;  // Stop the library first, it was connected
+    
+    // Input source and report-to-channel mapping
+    PS5LiveSource liveSource;
+    PS5InputSource* inputSource;
+    PS5InputMapper mapper;
+};
\ No newline at end of file
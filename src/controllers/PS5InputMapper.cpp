@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "PS5InputMapper.h"
+#include "../Config.h"
+#include "../utils/Utils.h"
+
+// Default channel and mode for each button, indexed by PS5Button; sticks uncalibrated
+static const ControllerProfile defaultProfile = {
+    {
+         8,  // BUTTON_CROSS    -> AUX5
+         9,  // BUTTON_CIRCLE   -> AUX6
+        10,  // BUTTON_SQUARE   -> AUX7
+        11,  // BUTTON_TRIANGLE -> AUX8
+         4,  // BUTTON_L1       -> AUX1
+         5,  // BUTTON_R1       -> AUX2
+        -1,  // BUTTON_L3
+        -1,  // BUTTON_R3
+        12,  // BUTTON_UP       -> AUX9
+        13,  // BUTTON_DOWN     -> AUX10
+        14,  // BUTTON_LEFT     -> AUX11
+        15,  // BUTTON_RIGHT    -> AUX12
+        -1,  // BUTTON_PS
+        -1,  // BUTTON_CREATE
+        -1,  // BUTTON_OPTIONS
+        -1,  // BUTTON_TOUCHPAD
+    },
+    {
+        0, 0, 0, 0,  // Face buttons momentary
+        2, 3,        // L1 2-position, R1 3-position toggle
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    { 0, 0, 0, 0 },
+    0,
+};
+
+// Gesture table. Holding PS turns the face buttons into latching toggles on
+// their normal channels; a long press on Options or L3+R3 releases every latch.
+// All 16 channels already carry a stick, trigger or button, so the shift layer
+// reuses the face button channels on purpose: a latch holds AUX5-AUX8 at MAX
+// without keeping the button down, and the shift press itself never reaches
+// the normal mapping. Bind a free channel here to get an independent switch.
+static const GestureBinding gestureBindings[] HOT_DATA = {
+    // type               layer                button           button2         action         ch  value
+    { GESTURE_PRESS,      GESTURE_LAYER_SHIFT, BUTTON_CROSS,    0,              ACTION_TOGGLE,  8, 0 },
+    { GESTURE_PRESS,      GESTURE_LAYER_SHIFT, BUTTON_CIRCLE,   0,              ACTION_TOGGLE,  9, 0 },
+    { GESTURE_PRESS,      GESTURE_LAYER_SHIFT, BUTTON_SQUARE,   0,              ACTION_TOGGLE, 10, 0 },
+    { GESTURE_PRESS,      GESTURE_LAYER_SHIFT, BUTTON_TRIANGLE, 0,              ACTION_TOGGLE, 11, 0 },
+    { GESTURE_LONG_PRESS, GESTURE_LAYER_BASE,  BUTTON_OPTIONS,  0,              ACTION_CLEAR,  -1, 0 },
+    { GESTURE_CHORD,      GESTURE_LAYER_BASE,  BUTTON_L3,       BUTTON_R3,      ACTION_CLEAR,  -1, 0 },
+};
+
+static_assert(sizeof(gestureBindings) / sizeof(gestureBindings[0]) <= GESTURE_MAX_BINDINGS,
+              "gestureBindings has more rows than GESTURE_MAX_BINDINGS");
+
+PS5InputMapper::PS5InputMapper(ChannelManager* channelManager) :
+    channelManager(channelManager),
+    gestures(gestureBindings, sizeof(gestureBindings) / sizeof(gestureBindings[0]), BUTTON_PS) {
+    
+    leftX = leftY = rightX = rightY = 0;
+    l2Value = r2Value = 0;
+    
+    loadProfile(defaultProfile);
+}
+
+HOT_FUNC void PS5InputMapper::apply(const PS5Report& report) {
+    // Get analog inputs, sticks through the controller's calibration
+    leftX = calibrate(report.leftX, ANALOG_LEFT_X);
+    leftY = calibrate(report.leftY, ANALOG_LEFT_Y);
+    rightX = calibrate(report.rightX, ANALOG_RIGHT_X);
+    rightY = calibrate(report.rightY, ANALOG_RIGHT_Y);
+    l2Value = report.l2;
+    r2Value = report.r2;
+    
+    // Gestures see the report first and hold back the buttons they consume;
+    // both use the report time so replays are deterministic
+    uint32_t heldMask = gestures.update(report.buttons, report.timeMs);
+    buttons.update(heldMask, report.timeMs);
+    
+    // Map controller values to channels, latched gesture channels win
+    mapControllerToChannels();
+    gestures.applyOverrides(channelManager);
+}
+
+int PS5InputMapper::getAnalogValue(int index) const {
+    switch (index) {
+        case ANALOG_LEFT_X: return leftX;
+        case ANALOG_LEFT_Y: return leftY;
+        case ANALOG_RIGHT_X: return rightX;
+        case ANALOG_RIGHT_Y: return rightY;
+        case ANALOG_L2: return l2Value;
+        case ANALOG_R2: return r2Value;
+        default: return 0;
+    }
+}
+
+bool PS5InputMapper::getButtonState(int index) const {
+    if (index < 0 || index >= PS5_BUTTON_COUNT) {
+        return false;
+    }
+    return buttons.getState(index) > 0;
+}
+
+void PS5InputMapper::setButtonConfig(PS5Button button, int numStates) {
+    profile.buttonStates[button] = numStates;
+    buttons.setNumStates(button, numStates);
+}
+
+void PS5InputMapper::resetAllButtons() {
+    buttons.reset();
+    gestures.reset();
+}
+
+void PS5InputMapper::loadProfile(const ControllerProfile& newProfile) {
+    profile = newProfile;
+    for (int i = 0; i < PS5_BUTTON_COUNT; i++) {
+        buttons.setNumStates(i, profile.buttonStates[i]);
+    }
+    resetAllButtons();
+}
+
+const ControllerProfile& PS5InputMapper::getProfile() const {
+    return profile;
+}
+
+const ControllerProfile& PS5InputMapper::getDefaultProfile() {
+    return defaultProfile;
+}
+
+HOT_FUNC int8_t PS5InputMapper::calibrate(int8_t value, int axis) const {
+    int offset = value - profile.stickCenter[axis];
+    if (offset >= -profile.stickDeadband && offset <= profile.stickDeadband) {
+        return 0;
+    }
+    return max(-128, min(127, offset));
+}
+
+HOT_FUNC void PS5InputMapper::mapControllerToChannels() {
+    // Map sticks to channels 0-3
+    channelManager->setChannel(0, mapValueClamped(leftX, -128, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));   // Channel 0: Left stick X
+    channelManager->setChannel(1, mapValueClamped(rightY, -128, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // Channel 1: Right stick Y
+    
+    // FIX: Left stick Y (throttle) - Only uses positive range (0 to 127) 
+    // Original mapping was treating up as max (127 → MAX) and center as min (-1 → MIN)
+    channelManager->setChannel(2, mapValueClamped(leftY, 0, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));   // Channel 2: Left stick Y
+    
+    channelManager->setChannel(3, mapValueClamped(rightX, -128, 127, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // Channel 3: Right stick X
+    
+    // Map triggers to channels 6-7
+    channelManager->setChannel(6, mapValueClamped(l2Value, 0, 255, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // AUX3 (L2 trigger)
+    channelManager->setChannel(7, mapValueClamped(r2Value, 0, 255, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX));  // AUX4 (R2 trigger)
+    
+    // Map buttons to their configured channels
+    for (int i = 0; i < PS5_BUTTON_COUNT; i++) {
+        if (profile.buttonChannels[i] >= 0) {
+            channelManager->setChannel(profile.buttonChannels[i], buttons.getValue(i));
+        }
+    }
+}
\ No newline at end of file
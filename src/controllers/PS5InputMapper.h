@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include "PS5Report.h"
+#include "../channels/ChannelManager.h"
+#include "../utils/ButtonEngine.h"
+#include "../utils/GestureEngine.h"
+
+// Per-controller mapping and calibration, stored with each bonded controller
+struct ControllerProfile {
+    int8_t buttonChannels[PS5_BUTTON_COUNT];  // Output channel per PS5Button, -1 unmapped
+    uint8_t buttonStates[PS5_BUTTON_COUNT];   // ≤1 momentary, otherwise N-state toggle
+    int8_t stickCenter[4];                    // Rest position per stick axis (PS5AnalogInput order)
+    uint8_t stickDeadband;                    // Stick offsets within this count read as center
+};
+
+// Turns DualSense reports into RC channel values. Has no dependency on the ps5
+// library so the same mapping runs on-device and in the host replay build.
+class PS5InputMapper {
+public:
+    PS5InputMapper(ChannelManager* channelManager);
+    
+    // Update button states from a report and map everything to channels
+    void apply(const PS5Report& report);
+    
+    // Get analog value from the last report
+    int getAnalogValue(int index) const;
+    
+    // Get button state (toggle or momentary)
+    bool getButtonState(int index) const;
+    
+    // Set button configuration (toggle/momentary)
+    void setButtonConfig(PS5Button button, int numStates);
+    
+    // Reset all button states
+    void resetAllButtons();
+    
+    // Switch to a controller's profile (a copy, no lookups); resets button states
+    void loadProfile(const ControllerProfile& profile);
+    const ControllerProfile& getProfile() const;
+    
+    // Built-in mapping used for controllers without a stored profile
+    static const ControllerProfile& getDefaultProfile();
+
+private:
+    // Stick value with calibration applied
+    int8_t calibrate(int8_t value, int axis) const;
+    
+    // Map controller inputs to channels
+    void mapControllerToChannels();
+    
+    ChannelManager* channelManager;
+    
+    // Active mapping and calibration
+    ControllerProfile profile;
+    
+    // Analog values
+    int leftX, leftY, rightX, rightY, l2Value, r2Value;
+    
+    // All buttons, indexed by PS5Button
+    ButtonEngine buttons;
+    
+    // Long press, double tap, chord and PS-shift gestures layered on top
+    GestureEngine gestures;
+};
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "PS5LiveSource.h"
+#include <ps5Controller.h>
+
+ReportQueue PS5LiveSource::reports;
+portMUX_TYPE PS5LiveSource::meterLock = portMUX_INITIALIZER_UNLOCKED;
+ReportRateMeter PS5LiveSource::meter;
+
+// ps5 library accessor for each button, indexed by PS5Button
+typedef bool (ps5Controller::*ButtonReader)();
+static const ButtonReader buttonReaders[PS5_BUTTON_COUNT] = {
+    &ps5Controller::Cross,
+    &ps5Controller::Circle,
+    &ps5Controller::Square,
+    &ps5Controller::Triangle,
+    &ps5Controller::L1,
+    &ps5Controller::R1,
+    &ps5Controller::L3,
+    &ps5Controller::R3,
+    &ps5Controller::Up,
+    &ps5Controller::Down,
+    &ps5Controller::Left,
+    &ps5Controller::Right,
+    &ps5Controller::PSButton,
+    &ps5Controller::Share,     // Labelled "Create" on the DualSense
+    &ps5Controller::Options,
+    &ps5Controller::Touchpad,
+};
+
+PS5LiveSource::PS5LiveSource() {
+}
+
+void PS5LiveSource::begin() {
+    ps5.attach(onReport);
+}
+
+bool PS5LiveSource::isConnected() {
+    return ps5.isConnected();
+}
+
+bool PS5LiveSource::poll(PS5Report& report) {
+    return reports.pop(report);
+}
+
+void PS5LiveSource::getReportStats(ReportRateStats& stats) const {
+    uint32_t nowUs = micros();
+    portENTER_CRITICAL(&meterLock);
+    meter.getStats(nowUs, stats);
+    portEXIT_CRITICAL(&meterLock);
+}
+
+void PS5LiveSource::onReport() {
+    // Arrival time in microseconds for the meter, milliseconds in the report
+    uint32_t nowUs = micros();
+    PS5Report report;
+    report.timeMs = millis();
+    report.leftX = ps5.LStickX();
+    report.leftY = ps5.LStickY();
+    report.rightX = ps5.RStickX();
+    report.rightY = ps5.RStickY();
+    report.l2 = ps5.L2Value();
+    report.r2 = ps5.R2Value();
+    
+    uint32_t buttons = 0;
+    for (int i = 0; i < PS5_BUTTON_COUNT; i++) {
+        if ((ps5.*buttonReaders[i])()) {
+            buttons |= PS5_BUTTON_BIT(i);
+        }
+    }
+    report.buttons = buttons;
+    
+    bool queued = reports.push(report);
+    
+    portENTER_CRITICAL(&meterLock);
+    meter.record(nowUs);
+    if (!queued) {
+        meter.recordOverflow();
+    }
+    portEXIT_CRITICAL(&meterLock);
+}
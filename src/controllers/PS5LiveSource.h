@@ -24,33 +24,31 @@
 #pragma once
 
 #include <Arduino.h>
-#include "../Config.h"
+#include "PS5InputSource.h"
+#include "ReportRateMeter.h"
+#include "ReportQueue.h"
 
-class ButtonStateManager {
+// Input source backed by the ps5 library. The library's notify callback runs on
+// the Bluetooth task; it snapshots each report with its arrival time and queues
+// it, so the loop task sees every report, whole and in order.
+class PS5LiveSource : public PS5InputSource {
 public:
-    // Constructor
-    ButtonStateManager(const char* buttonName, int stateCount = 2);
+    PS5LiveSource();
     
-    // Change number of states (can be called at runtime)
-    void setNumStates(int newNumStates);
+    // Register the report callback with the ps5 library
+    void begin();
     
-    // Update button state based on current press
-    void update(bool isPressed);
-    
-    // Get current value based on state - calculated on demand
-    int getValue() const;
-    
-    // Get current state (for UI)
-    int getState() const;
-    
-    // Reset state to default
-    void reset();
+    bool isConnected() override;
+    bool poll(PS5Report& report) override;
     
+    // Rate and inter-arrival statistics of the reports
+    void getReportStats(ReportRateStats& stats) const;
+
 private:
-    const char* name;          // Button name for debugging
-    int numStates;             // Number of states this button cycles through (>1 for toggle, ≤1 for momentary)
-    int currentState;          // Current state (0 to numStates-1)
-    bool wasPressed;           // Previous button state
-    unsigned long lastPress;   // Time of last button press
-    bool momentaryMode;        // True if button is momentary (not toggle)
-}; 
\ No newline at end of file
+    // Called by the ps5 library for every input report
+    static void onReport();
+    
+    static ReportQueue reports;
+    static portMUX_TYPE meterLock;
+    static ReportRateMeter meter;
+};
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+
+// Enum for PS5 controller analog inputs
+enum PS5AnalogInput {
+    ANALOG_LEFT_X = 0,
+    ANALOG_LEFT_Y = 1,
+    ANALOG_RIGHT_X = 2,
+    ANALOG_RIGHT_Y = 3,
+    ANALOG_L2 = 4,
+    ANALOG_R2 = 5
+};
+
+// Enum for PS5 controller buttons
+enum PS5Button {
+    BUTTON_CROSS = 0,
+    BUTTON_CIRCLE = 1,
+    BUTTON_SQUARE = 2,
+    BUTTON_TRIANGLE = 3,
+    BUTTON_L1 = 4,
+    BUTTON_R1 = 5,
+    BUTTON_L3 = 6,
+    BUTTON_R3 = 7,
+    BUTTON_UP = 8,
+    BUTTON_DOWN = 9,
+    BUTTON_LEFT = 10,
+    BUTTON_RIGHT = 11,
+    BUTTON_PS = 12,
+    BUTTON_CREATE = 13,
+    BUTTON_OPTIONS = 14,
+    BUTTON_TOUCHPAD = 15
+};
+
+// Number of buttons in PS5Button
+#define PS5_BUTTON_COUNT 16
+
+// Bit for a button in PS5Report::buttons
+#define PS5_BUTTON_BIT(button) (1UL << (button))
+
+// One raw DualSense input report, as delivered by the ps5 library or a replay trace
+struct PS5Report {
+    uint32_t timeMs;   // Report timestamp
+    int8_t leftX;      // Sticks, -128 to 127
+    int8_t leftY;
+    int8_t rightX;
+    int8_t rightY;
+    uint8_t l2;        // Analog triggers, 0 to 255
+    uint8_t r2;
+    uint32_t buttons;  // PS5_BUTTON_BIT(button) is set while the button is held
+};
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ReconnectEngine.h"
+#include "../utils/Log.h"
+#include "../utils/BluetoothLock.h"
+#include "../utils/Utils.h"
+#include "../Config.h"
+
+ReconnectEngine::ReconnectEngine() :
+    hasTarget(false),
+    state(RECONNECT_IDLE),
+    lostAt(0),
+    nextPageAt(0),
+    backoffMs(RECONNECT_BACKOFF_MIN_MS),
+    pageCount(0),
+    lastRecoveryMs(0),
+    lastPageCount(0) {
+    memset(target, 0, sizeof(target));
+}
+
+void ReconnectEngine::setTarget(const char* mac) {
+    retarget(mac);
+    state = RECONNECT_IDLE;
+}
+
+void ReconnectEngine::retarget(const char* mac) {
+    hasTarget = parseMac(mac, target);
+    if (!hasTarget) {
+        memset(target, 0, sizeof(target));
+    }
+}
+
+void ReconnectEngine::pageNow(bool connected, unsigned long now) {
+    if (connected || !hasTarget) {
+        return;
+    }
+    
+    // Recovery is measured from the request; backoff starts over
+    lostAt = now;
+    nextPageAt = now;
+    backoffMs = RECONNECT_BACKOFF_MIN_MS;
+    pageCount = 0;
+    state = RECONNECT_PAGING;
+    LOG_I(LOG_INPUT, "Paging controller on request");
+}
+
+void ReconnectEngine::update(bool connected, bool gotReport, unsigned long now) {
+    switch (state) {
+        case RECONNECT_IDLE:
+            // The first connection is made by the controller, nothing to page yet
+            if (connected) {
+                state = RECONNECT_LINKED;
+            }
+            break;
+            
+        case RECONNECT_LINKED:
+            if (!connected) {
+                // Page right away, then back off
+                lostAt = now;
+                nextPageAt = now;
+                backoffMs = RECONNECT_BACKOFF_MIN_MS;
+                pageCount = 0;
+                state = RECONNECT_PAGING;
+                LOG_I(LOG_INPUT, "Link lost, paging controller");
+            }
+            break;
+            
+        case RECONNECT_PAGING:
+            if (connected) {
+                state = RECONNECT_WAIT_REPORT;
+            } else if ((long)(now - nextPageAt) >= 0) {
+                page(now);
+            }
+            break;
+            
+        case RECONNECT_WAIT_REPORT:
+            if (!connected) {
+                // Dropped again before a report; keep the original dropout time
+                nextPageAt = now;
+                state = RECONNECT_PAGING;
+            } else if (gotReport) {
+                lastRecoveryMs = now - lostAt;
+                lastPageCount = pageCount;
+                state = RECONNECT_LINKED;
+                LOG_I(LOG_INPUT, "Reconnected: first report %lu ms after dropout, %u pages",
+                      (unsigned long)lastRecoveryMs, lastPageCount);
+            }
+            break;
+    }
+}
+
+void ReconnectEngine::page(unsigned long now) {
+    // A remote name request pages the controller and brings up the ACL link
+    // with the stored link key; the ps5 library picks up the HID channels.
+    // The loop does not wait out a stack restart or a scan start, the page
+    // is tried again next loop
+    if (hasTarget) {
+        if (!BluetoothLock::take(0)) {
+            return;
+        }
+        esp_err_t result = esp_bt_gap_read_remote_name(target);
+        BluetoothLock::give();
+        if (result != ESP_OK) {
+            LOG_D(LOG_INPUT, "Page request failed: %d", result);
+        }
+        pageCount++;
+    }
+    
+    nextPageAt = now + backoffMs;
+    backoffMs = min(backoffMs * 2, (uint32_t)RECONNECT_BACKOFF_MAX_MS);
+}
+
+ReconnectState ReconnectEngine::getState() const {
+    return state;
+}
+
+uint32_t ReconnectEngine::getLastRecoveryMs() const {
+    return lastRecoveryMs;
+}
+
+uint16_t ReconnectEngine::getLastPageCount() const {
+    return lastPageCount;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <esp_gap_bt_api.h>
+
+// Where the reconnect engine is
+enum ReconnectState : uint8_t {
+    RECONNECT_IDLE = 0,     // No link yet since the target was set
+    RECONNECT_LINKED,       // Connected and reports flowing
+    RECONNECT_PAGING,       // Link lost, paging the controller with backoff
+    RECONNECT_WAIT_REPORT   // Link back, waiting for the first report
+};
+
+// Brings a dropped controller back without restarting the Bluetooth stack.
+// The bond (link key) and the ps5 library's L2CAP listeners stay in place;
+// the saved address is paged on an exponential backoff so the ACL link can
+// come back as soon as the controller is in range, and the time from the
+// dropout to the first valid report is measured.
+class ReconnectEngine {
+public:
+    ReconnectEngine();
+    
+    // Address to page, "xx:xx:xx:xx:xx:xx"; resets to IDLE
+    void setTarget(const char* mac);
+    
+    // Page a different address from now on, keeping the state (bond rotation)
+    void retarget(const char* mac);
+    
+    // Start paging now, whatever the state (a controller that never linked,
+    // or a retry asked for from the UI); no-op while linked
+    void pageNow(bool connected, unsigned long now);
+    
+    // Called every loop with the link state and whether a report arrived
+    void update(bool connected, bool gotReport, unsigned long now);
+    
+    ReconnectState getState() const;
+    
+    // Dropout to first report of the last recovery, and the pages it took
+    uint32_t getLastRecoveryMs() const;
+    uint16_t getLastPageCount() const;
+
+private:
+    void page(unsigned long now);
+    
+    esp_bd_addr_t target;
+    bool hasTarget;
+    ReconnectState state;
+    
+    unsigned long lostAt;
+    unsigned long nextPageAt;
+    uint32_t backoffMs;
+    uint16_t pageCount;
+    
+    uint32_t lastRecoveryMs;
+    uint16_t lastPageCount;
+};
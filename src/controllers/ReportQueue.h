@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include "PS5Report.h"
+#include "../Config.h"
+
+// Single-producer, single-consumer FIFO of input reports. The Bluetooth task
+// pushes every report as it arrives and the loop task pops them in order, so
+// a press and release that both land between two loop passes reach the mapper
+// as two reports, each with its own arrival time.
+class ReportQueue {
+public:
+    ReportQueue() : head(0), tail(0) {
+    }
+    
+    // Producer only; false when full, the report is then dropped
+    bool push(const PS5Report& report) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= REPORT_QUEUE_SIZE) {
+            return false;
+        }
+        slots[h & (REPORT_QUEUE_SIZE - 1)] = report;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Consumer only; false when empty
+    bool pop(PS5Report& report) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        report = slots[t & (REPORT_QUEUE_SIZE - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static_assert((REPORT_QUEUE_SIZE & (REPORT_QUEUE_SIZE - 1)) == 0, "REPORT_QUEUE_SIZE must be a power of two");
+    
+    PS5Report slots[REPORT_QUEUE_SIZE];
+    std::atomic<uint32_t> head;   // Written by the producer
+    std::atomic<uint32_t> tail;   // Written by the consumer
+};
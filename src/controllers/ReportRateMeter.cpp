@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ReportRateMeter.h"
+#include <string.h>
+
+// Rolling rate window
+#define RATE_WINDOW_US 1000000UL
+
+ReportRateMeter::ReportRateMeter() :
+    lastUs(0),
+    windowStartUs(0),
+    windowCount(0),
+    started(false) {
+    memset(&stats, 0, sizeof(stats));
+}
+
+void ReportRateMeter::record(uint32_t nowUs) {
+    // The first report after a long silence starts a new session, with its
+    // own counts; the silence itself is not a gap
+    uint32_t interval = nowUs - lastUs;
+    if (!started || interval >= REPORT_SESSION_GAP_MS * 1000UL) {
+        uint32_t session = stats.session + 1;
+        memset(&stats, 0, sizeof(stats));
+        stats.session = session;
+        stats.reports = 1;
+        started = true;
+        lastUs = nowUs;
+        windowStartUs = nowUs;
+        windowCount = 0;
+        return;
+    }
+    lastUs = nowUs;
+    stats.reports++;
+    
+    // Bin by powers of two: bin i holds intervals below 2^(i+1) ms
+    int bin = 0;
+    uint32_t limitUs = 2000;
+    while (bin < REPORT_HISTOGRAM_BINS - 1 && interval >= limitUs) {
+        bin++;
+        limitUs <<= 1;
+    }
+    stats.histogram[bin]++;
+    
+    if (interval > REPORT_GAP_THRESHOLD_MS * 1000UL) {
+        stats.gaps++;
+    }
+    if (interval > stats.longestGapUs) {
+        stats.longestGapUs = interval;
+    }
+    
+    // Rate over the last full window
+    windowCount++;
+    uint32_t elapsed = nowUs - windowStartUs;
+    if (elapsed >= RATE_WINDOW_US) {
+        stats.rateHz = (uint16_t)((uint64_t)windowCount * 1000000ULL / elapsed);
+        windowStartUs = nowUs;
+        windowCount = 0;
+    }
+}
+
+void ReportRateMeter::recordOverflow() {
+    stats.overflows++;
+}
+
+void ReportRateMeter::getStats(uint32_t nowUs, ReportRateStats& out) const {
+    out = stats;
+    if (!started || nowUs - lastUs >= RATE_WINDOW_US) {
+        out.rateHz = 0;
+    }
+}
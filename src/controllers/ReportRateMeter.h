@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include "../Config.h"
+
+// Inter-arrival histogram bins; bin i counts intervals below 2^(i+1) ms, the
+// last one everything longer
+#define REPORT_HISTOGRAM_BINS 8
+
+// Report arrival statistics of the current link session. A session starts
+// with the first report after REPORT_SESSION_GAP_MS of silence (a connect or
+// reconnect), which resets everything but the rate and the session number.
+struct ReportRateStats {
+    uint16_t rateHz;                               // Reports in the last full second, 0 once they stop
+    uint32_t session;                              // Sessions since boot, to tell when counts restarted
+    uint32_t reports;                              // Reports seen
+    uint32_t gaps;                                 // Inter-arrivals over REPORT_GAP_THRESHOLD_MS
+    uint32_t longestGapUs;                         // Longest inter-arrival
+    uint32_t overflows;                            // Reports dropped because the queue was full
+    uint32_t histogram[REPORT_HISTOGRAM_BINS];
+};
+
+// Timestamps input reports as they arrive and keeps their rate, inter-arrival
+// histogram and gap count. record() runs on the task delivering the reports;
+// readers copy the stats under the same lock the reports are handed over with.
+class ReportRateMeter {
+public:
+    ReportRateMeter();
+    
+    // Count a report that arrived at nowUs (micros())
+    void record(uint32_t nowUs);
+    
+    // Count a report that was dropped before reaching the loop task
+    void recordOverflow();
+    
+    // Copy the stats, with the rate dropped to 0 when reports stopped
+    void getStats(uint32_t nowUs, ReportRateStats& out) const;
+
+private:
+    ReportRateStats stats;
+    uint32_t lastUs;
+    uint32_t windowStartUs;
+    uint32_t windowCount;
+    bool started;
+};
@@ -22,12 +22,32 @@
 
 
 #include "CRSFModule.h"
-#include "../utils/Utils.h"
+#include "../utils/Log.h"
+#include "../utils/BootTimeline.h"
+#include "CRSFFrame.h"
+#include <soc/gpio_struct.h>
+#include <esp32/rom/ets_sys.h>
+
+// Inverted UART line levels and the debug LED, written straight to the GPIO
+// set/clear registers (both pins are below 32)
+#define CRSF_TX_MASK (1UL << CRSF_TX_PIN)
+#define DEBUG_LED_MASK (1UL << DEBUG_LED_PIN)
 
 CRSFModule::CRSFModule(ChannelManager* channelManager) : 
     channelManager(channelManager),
+    recorder(nullptr),
     debugMode(false),
-    lastUpdateTime(0) {
+    nextFrameTick(0),
+    lastFrameUs(0),
+    bitCycles(0),
+    statsFrames(0),
+    statsBuildCycles(0),
+    statsBuildMax(0),
+    statsSendMax(0),
+    statsIntervals(0),
+    statsJitterTotal(0),
+    statsJitterMax(0),
+    lastStatsTime(0) {
 }
 
 void CRSFModule::begin() {
@@ -39,125 +59,120 @@ void CRSFModule::begin() {
     pinMode(DEBUG_LED_PIN, OUTPUT);
     digitalWrite(DEBUG_LED_PIN, LOW);
     
-    Serial.println("CRSF software UART initialized on pin " + String(CRSF_TX_PIN));
+    LOG_I(LOG_CRSF, "CRSF software UART initialized on pin %d", CRSF_TX_PIN);
+    
+    // The receiver gets (failsafe) channels from the first moments of boot
+    sendRcChannelsPacket();
+    nextFrameTick = xTaskGetTickCount() + pdMS_TO_TICKS(CRSF_FRAME_INTERVAL_MS);
+    lastStatsTime = millis();
+    BootTimeline::mark(BOOT_FIRST_FRAME);
 }
 
 void CRSFModule::update() {
-    // Send CRSF packets at regular intervals (approximately 50Hz)
-    unsigned long currentTime = millis();
-    if (currentTime - lastUpdateTime >= 20) {  // 50Hz update rate
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(now - nextFrameTick) >= 0) {
+        nextFrameTick += pdMS_TO_TICKS(CRSF_FRAME_INTERVAL_MS);
+        
+        // A whole slot was missed (boot, a stalled loop): restart the grid
+        // from now rather than sending the missed frames back to back
+        if ((int32_t)(now - nextFrameTick) >= 0) {
+            nextFrameTick = now + pdMS_TO_TICKS(CRSF_FRAME_INTERVAL_MS);
+            lastFrameUs = 0;
+        }
         sendRcChannelsPacket();
-        lastUpdateTime = currentTime;
+    }
+    
+    unsigned long currentTime = millis();
+    if (currentTime - lastStatsTime >= CRSF_STATS_INTERVAL_MS) {
+        logFrameStats(currentTime);
     }
 }
 
+TickType_t CRSFModule::getTicksUntilNextFrame() const {
+    int32_t ticks = (int32_t)(nextFrameTick - xTaskGetTickCount());
+    return ticks > 0 ? (TickType_t)ticks : 0;
+}
+
 void CRSFModule::setDebugMode(bool debug) {
     debugMode = debug;
 }
 
-void CRSFModule::sendRcChannelsPacket() {
+void CRSFModule::setRecorder(FlightRecorder* recorder) {
+    this->recorder = recorder;
+}
+
+HOT_FUNC void CRSFModule::sendRcChannelsPacket() {
     uint8_t frame[CRSF_FRAME_SIZE];
     
+    // Frame start against the previous one, which the receiver sees as jitter
+    uint32_t frameUs = micros();
+    if (lastFrameUs != 0) {
+        int32_t deviation = (int32_t)(frameUs - lastFrameUs) - CRSF_FRAME_INTERVAL_MS * 1000;
+        uint32_t jitter = deviation < 0 ? -deviation : deviation;
+        statsIntervals++;
+        statsJitterTotal += jitter;
+        statsJitterMax = max(statsJitterMax, jitter);
+    }
+    lastFrameUs = frameUs;
+    
     // Send sync preamble to help receiver synchronize
     sendSyncPreamble();
     
-    // Add header
-    frame[0] = CRSF_ADDRESS_FLIGHT_CONTROLLER;
-    frame[1] = 24; // Length byte (payload + type + CRC = 22 + 1 + 1 = 24)
-    frame[2] = CRSF_FRAMETYPE_RC_CHANNELS_PACKED;
-    
-    // Pack the channels into the payload
-    packRcChannels(&frame[3], channelManager->getChannelData());
-    
-    // Calculate and add CRC
-    frame[25] = crcCRSF(&frame[2], 23); // CRC over type + payload
+    // Build header, packed channels and CRC
+    uint32_t buildStart = ESP.getCycleCount();
+    buildRcChannelsFrame(frame, channelManager->getChannelData());
+    uint32_t sendStart = ESP.getCycleCount();
     
     // Send the frame
     softUartSendBytes(frame, CRSF_FRAME_SIZE);
     
+    uint32_t buildCycles = sendStart - buildStart;
+    uint32_t sendCycles = ESP.getCycleCount() - sendStart;
+    statsFrames++;
+    statsBuildCycles += buildCycles;
+    statsBuildMax = max(statsBuildMax, buildCycles);
+    statsSendMax = max(statsSendMax, sendCycles);
+    
+    // Capture exactly what went out on the wire
+    if (recorder != nullptr) {
+        recorder->record(channelManager->getChannelData());
+    }
+    
     // Debug output - show the channel values and first few bytes of the packed data
     if (debugMode) {
         static unsigned long lastDebugPrint = 0;
         if (millis() - lastDebugPrint > 500) { // Print only every 500ms to avoid flooding
-            Serial.printf("CH0:%d CH1:%d CH2:%d CH3:%d | Data: %02X %02X %02X %02X\n", 
-                        channelManager->getChannel(0), channelManager->getChannel(1), 
-                        channelManager->getChannel(2), channelManager->getChannel(3),
-                        frame[3], frame[4], frame[5], frame[6]);
+            LOG_D(LOG_CRSF, "CH0:%d CH1:%d CH2:%d CH3:%d | Data: %08X",
+                  channelManager->getChannel(0), channelManager->getChannel(1),
+                  channelManager->getChannel(2), channelManager->getChannel(3),
+                  (frame[3] << 24) | (frame[4] << 16) | (frame[5] << 8) | frame[6]);
             lastDebugPrint = millis();
         }
     }
 }
 
-void CRSFModule::packRcChannels(uint8_t *buffer, const uint16_t *channels) {
-    // CRSF uses 11 bits per channel, packed across bytes
-    
-    // Channel 0: 8 bits in byte 0, 3 bits in byte 1
-    buffer[0] = (channels[0] & 0xFF);
-    buffer[1] = ((channels[0] >> 8) & 0x07);
-    
-    // Channel 1: 5 bits in byte 1, 6 bits in byte 2
-    buffer[1] |= ((channels[1] & 0x1F) << 3);
-    buffer[2] = ((channels[1] >> 5) & 0x3F);
-    
-    // Channel 2: 2 bits in byte 2, 8 bits in byte 3, 1 bit in byte 4
-    buffer[2] |= ((channels[2] & 0x03) << 6);
-    buffer[3] = ((channels[2] >> 2) & 0xFF);
-    buffer[4] = ((channels[2] >> 10) & 0x01);
-    
-    // Channel 3: 7 bits in byte 4, 4 bits in byte 5
-    buffer[4] |= ((channels[3] & 0x7F) << 1);
-    buffer[5] = ((channels[3] >> 7) & 0x0F);
-    
-    // Channel 4: 4 bits in byte 5, 7 bits in byte 6
-    buffer[5] |= ((channels[4] & 0x0F) << 4);
-    buffer[6] = ((channels[4] >> 4) & 0x7F);
-    
-    // Channel 5: 1 bit in byte 6, 8 bits in byte 7, 2 bits in byte 8
-    buffer[6] |= ((channels[5] & 0x01) << 7);
-    buffer[7] = ((channels[5] >> 1) & 0xFF);
-    buffer[8] = ((channels[5] >> 9) & 0x03);
-    
-    // Channel 6: 6 bits in byte 8, 5 bits in byte 9
-    buffer[8] |= ((channels[6] & 0x3F) << 2);
-    buffer[9] = ((channels[6] >> 6) & 0x1F);
-    
-    // Channel 7: 3 bits in byte 9, 8 bits in byte 10
-    buffer[9] |= ((channels[7] & 0x07) << 5);
-    buffer[10] = ((channels[7] >> 3) & 0xFF);
-    
-    // Channel 8: 0 bits in byte 10, 8 bits in byte 11, 3 bits in byte 12
-    buffer[11] = (channels[8] & 0xFF);
-    buffer[12] = ((channels[8] >> 8) & 0x07);
-    
-    // Channel 9: 5 bits in byte 12, 6 bits in byte 13
-    buffer[12] |= ((channels[9] & 0x1F) << 3);
-    buffer[13] = ((channels[9] >> 5) & 0x3F);
-    
-    // Channel 10: 2 bits in byte 13, 8 bits in byte 14, 1 bit in byte 15
-    buffer[13] |= ((channels[10] & 0x03) << 6);
-    buffer[14] = ((channels[10] >> 2) & 0xFF);
-    buffer[15] = ((channels[10] >> 10) & 0x01);
-    
-    // Channel 11: 7 bits in byte 15, 4 bits in byte 16
-    buffer[15] |= ((channels[11] & 0x7F) << 1);
-    buffer[16] = ((channels[11] >> 7) & 0x0F);
-    
-    // Channel 12: 4 bits in byte 16, 7 bits in byte 17
-    buffer[16] |= ((channels[12] & 0x0F) << 4);
-    buffer[17] = ((channels[12] >> 4) & 0x7F);
-    
-    // Channel 13: 1 bit in byte 17, 8 bits in byte 18, 2 bits in byte 19
-    buffer[17] |= ((channels[13] & 0x01) << 7);
-    buffer[18] = ((channels[13] >> 1) & 0xFF);
-    buffer[19] = ((channels[13] >> 9) & 0x03);
-    
-    // Channel 14: 6 bits in byte 19, 5 bits in byte 20
-    buffer[19] |= ((channels[14] & 0x3F) << 2);
-    buffer[20] = ((channels[14] >> 6) & 0x1F);
-    
-    // Channel 15: 3 bits in byte 20, 8 bits in byte 21
-    buffer[20] |= ((channels[15] & 0x07) << 5);
-    buffer[21] = ((channels[15] >> 3) & 0xFF);
+void CRSFModule::logFrameStats(unsigned long currentTime) {
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    if (statsFrames > 0) {
+        LOG_I(LOG_CRSF, "%lu frames, build %lu ns avg / %lu ns max, send %lu us max",
+              (unsigned long)statsFrames,
+              (unsigned long)(statsBuildCycles / statsFrames * 1000 / mhz),
+              (unsigned long)(statsBuildMax * 1000 / mhz),
+              (unsigned long)(statsSendMax / mhz));
+    }
+    if (statsIntervals > 0) {
+        LOG_I(LOG_CRSF, "frame interval jitter %lu us avg / %lu us max",
+              (unsigned long)(statsJitterTotal / statsIntervals),
+              (unsigned long)statsJitterMax);
+    }
+    statsFrames = 0;
+    statsBuildCycles = 0;
+    statsBuildMax = 0;
+    statsSendMax = 0;
+    statsIntervals = 0;
+    statsJitterTotal = 0;
+    statsJitterMax = 0;
+    lastStatsTime = currentTime;
 }
 
 void CRSFModule::sendSyncPreamble() {
@@ -169,23 +184,26 @@ void CRSFModule::sendSyncPreamble() {
     delayMicroseconds(100);
 }
 
-void CRSFModule::softUartSendBytes(const uint8_t *data, size_t len) {
+IRAM_ATTR void CRSFModule::softUartSendBytes(const uint8_t *data, size_t len) {
     // Toggle debug LED to indicate transmission
-    digitalWrite(DEBUG_LED_PIN, HIGH);
+    GPIO.out_w1ts = DEBUG_LED_MASK;
+    
+    // Bit time at the frequency the CPU runs at for this frame (ROM call)
+    bitCycles = BIT_TIME_US * ets_get_cpu_frequency();
     
     for (size_t i = 0; i < len; i++) {
         softUartSendByte(data[i]);
     }
     
     // Ensure line returns to idle state (inverted UART idle = LOW)
-    digitalWrite(CRSF_TX_PIN, LOW);
+    GPIO.out_w1tc = CRSF_TX_MASK;
     
     // Turn off debug LED
-    digitalWrite(DEBUG_LED_PIN, LOW);
+    GPIO.out_w1tc = DEBUG_LED_MASK;
 }
 
-void CRSFModule::softUartSendByte(uint8_t data) {
-    // Must be in IRAM for consistent timing
+IRAM_ATTR void CRSFModule::softUartSendByte(uint8_t data) {
+    // In IRAM for consistent timing: no flash cache miss inside a byte
     noInterrupts();
     
     // Start bit (logical 0, inverted to HIGH)
@@ -201,24 +219,27 @@ void CRSFModule::softUartSendByte(uint8_t data) {
     
     // Extra delay for frame spacing
     uint32_t start = ESP.getCycleCount();
-    uint32_t target = start + ((BIT_TIME_US / 2) * ESP.getCpuFreqMHz());
+    uint32_t spacing = bitCycles / 2;
     
-    while (ESP.getCycleCount() < target) {
+    while (ESP.getCycleCount() - start < spacing) {
         // Spacing delay
     }
     
     interrupts();
 }
 
-void CRSFModule::uartSendBit(bool bit_value) {
+IRAM_ATTR void CRSFModule::uartSendBit(bool bit_value) {
     // For inverted UART: true=LOW, false=HIGH
-    digitalWrite(CRSF_TX_PIN, !bit_value);
+    if (bit_value) {
+        GPIO.out_w1tc = CRSF_TX_MASK;
+    } else {
+        GPIO.out_w1ts = CRSF_TX_MASK;
+    }
     
-    // Very precise delay
+    // Very precise delay; the subtraction stays correct across a counter wrap
     uint32_t start = ESP.getCycleCount();
-    uint32_t target = start + (BIT_TIME_US * ESP.getCpuFreqMHz());
     
-    while (ESP.getCycleCount() < target) {
+    while (ESP.getCycleCount() - start < bitCycles) {
         // Tight busy-wait for precise timing
     }
-} 
\ No newline at end of file
+}
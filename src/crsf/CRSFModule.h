@@ -26,24 +26,31 @@
 #include <Arduino.h>
 #include "../channels/ChannelManager.h"
 #include "../Config.h"
+#include "../recorder/FlightRecorder.h"
 
 class CRSFModule {
 public:
     CRSFModule(ChannelManager* channelManager);
     
-    // Initialize CRSF module
+    // Initialize CRSF module and send the first frame right away
     void begin();
     
-    // Update CRSF transmission
+    // Send a frame if one is due
     void update();
     
+    // Ticks until the next frame is due, 0 when it is due now. The loop sleeps
+    // this long, so it wakes on the tick the frame is scheduled for
+    TickType_t getTicksUntilNextFrame() const;
+    
     // Set debug mode (for serial output)
     void setDebugMode(bool debug);
+    
+    // Attach a flight recorder that captures every transmitted frame
+    void setRecorder(FlightRecorder* recorder);
 
 private:
     // Methods for CRSF packet building and transmission
     void sendRcChannelsPacket();
-    void packRcChannels(uint8_t *buffer, const uint16_t *channels);
     void sendSyncPreamble();
     
     // Methods for software UART transmission
@@ -51,7 +58,29 @@ private:
     void softUartSendByte(uint8_t data);
     void uartSendBit(bool bit_value);
     
+    // Log frame build and send times every CRSF_STATS_INTERVAL_MS
+    void logFrameStats(unsigned long currentTime);
+    
     ChannelManager* channelManager;
+    FlightRecorder* recorder;
     bool debugMode;
-    unsigned long lastUpdateTime;
+    
+    // Frames go out on a fixed tick grid, not relative to when update() ran
+    TickType_t nextFrameTick;
+    uint32_t lastFrameUs;   // Start of the previous frame, 0 after a missed slot
+    
+    // CPU cycles per bit, taken once per frame at the current CPU frequency
+    uint32_t bitCycles;
+    
+    // Frame timing since the last stats line, in CPU cycles
+    uint32_t statsFrames;
+    uint32_t statsBuildCycles;
+    uint32_t statsBuildMax;
+    uint32_t statsSendMax;
+    
+    // Deviation of frame starts from CRSF_FRAME_INTERVAL_MS, in microseconds
+    uint32_t statsIntervals;
+    uint32_t statsJitterTotal;
+    uint32_t statsJitterMax;
+    unsigned long lastStatsTime;
 }; 
\ No newline at end of file
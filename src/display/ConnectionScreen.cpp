@@ -22,7 +22,10 @@
 
 
 #include "ConnectionScreen.h"
-#include <Preferences.h>
+#include "../utils/Log.h"
+#include "../utils/ConfigStore.h"
+#include "../utils/BluetoothLock.h"
+#include "../utils/Utils.h"
 #include <BluetoothSerial.h>
 #include "ScreenManager.h"
 
@@ -46,43 +49,70 @@ static void empty_cb(BTAdvertisedDevice* device) {
     // Do nothing - just a placeholder for stopping discovery
 }
 
-// Variable to store the active ConnectionScreen instance for callback
-static ConnectionScreen* activeConnectionScreen = nullptr;
+// Discovery results on their way from the Bluetooth task to the UI task
+static DiscoveryQueue discoveryQueue;
 
 // The Discovery callback (needs to match BTAdvertisedDeviceCb signature)
+// Runs on the Bluetooth task: copies the result into a fixed-size record and returns
 static void bt_discovery_cb(BTAdvertisedDevice* device) {
-    // Use the global instance to add the device
-    if (activeConnectionScreen) {
-        // Get device info as Strings
-        String name = device->haveName() ? device->getName().c_str() : "Unknown Device";
-        String address = device->getAddress().toString().c_str();
-        
-        // Add to list via the ConnectionScreen method
-        activeConnectionScreen->addDeviceToList(name, address);
+    DiscoveryRecord record;
+    memcpy(record.address, *device->getAddress().getNative(), sizeof(record.address));
+    
+    if (device->haveName()) {
+        snprintf(record.name, sizeof(record.name), "%s", device->getName().c_str());
+    } else {
+        record.name[0] = '\0';
     }
+    
+    record.rssi = device->haveRSSI() ? device->getRSSI() : DISCOVERY_RSSI_UNKNOWN;
+    
+    discoveryQueue.push(record);
 }
 
 ConnectionScreen::ConnectionScreen(PS5Controller* controller) : 
     ps5Controller(controller),
     selectedIndex(0),
-    isScanning(false),
+    scanState(SCAN_IDLE),
+    scanStateSince(0),
+    pendingQuick(false),
     scanStartTime(0),
     useActiveScanning(true),
+    quickPair(false),
+    quickPairFound(false),
+    quickPairMac(0),
+    quickPairStartTime(0),
     isFirstActivation(true),
     hasSavedMac(false),
-    currentPage(0) {
-    
-    // Calculate how many items can fit on the screen
-    itemsPerPage = calculateItemsPerPage();
+    currentPage(0),
+    itemsPerPage(calculateItemsPerPage()),
+    title(0, 0, M5.Lcd.width(), 10, TL_DATUM, 1, YELLOW),
+    countdown(0, 10, M5.Lcd.width(), 10, TL_DATUM, 1, GREEN),
+    list(0, HEADER_HEIGHT, M5.Lcd.width(), ITEM_HEIGHT, itemsPerPage * 2),
+    page(0, M5.Lcd.height() - FOOTER_HEIGHT, M5.Lcd.width(), 10, TL_DATUM, 1, WHITE),
+    helpSelect(0, M5.Lcd.height() - 20, M5.Lcd.width(), 10, TL_DATUM, 1, CYAN),
+    helpNavigate(0, M5.Lcd.height() - 10, M5.Lcd.width(), 10, TL_DATUM, 1, CYAN) {
+    
+    // The list may hold fewer rows than the screen has room for
+    itemsPerPage = list.getRowCount() / 2;
+    
+    title.setText(" Bluetooth Menu");
+    helpSelect.setText("A: Select Option");
+    helpNavigate.setText("B: Next | Long B: Prev");
+    
+    addWidget(&title);
+    addWidget(&countdown);
+    addWidget(&list);
+    addWidget(&page);
+    addWidget(&helpSelect);
+    addWidget(&helpNavigate);
 }
 
 int ConnectionScreen::calculateItemsPerPage() const {
     // Calculate how many two-line items can fit on the screen
-    // Each item needs 2 lines of ITEM_HEIGHT plus a gap of ITEM_GAP
-    // Reserve space for title (2 lines) and bottom instruction (2 lines)
-    const int reservedHeight = 4 * ITEM_HEIGHT;
+    // Reserve space for the title and scan status above and the page and instructions below
+    const int reservedHeight = HEADER_HEIGHT + FOOTER_HEIGHT;
     const int availableHeight = M5.Lcd.height() - reservedHeight;
-    const int singleItemHeight = (2 * ITEM_HEIGHT) + ITEM_GAP;
+    const int singleItemHeight = 2 * ITEM_HEIGHT;
     
     // Calculate how many complete items can fit
     int itemCount = availableHeight / singleItemHeight;
@@ -96,29 +126,18 @@ void ConnectionScreen::setFirstActivation(bool isFirst) {
 }
 
 void ConnectionScreen::activate() {
-    // Initialize display
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextColor(WHITE);
-    M5.Lcd.setTextSize(1);
-    
     // Clear device list first
     devices.clear();
     
-    // Load saved MAC if available
-    BluetoothDevice savedDevice;
-    hasSavedMac = loadSavedMac(savedDevice);
-    
-    if (hasSavedMac) {
-        // Add the saved device to the list
-        devices.push_back(savedDevice);
-    }
+    // Load saved MAC if available; the saved device always sorts first
+    hasSavedMac = loadSavedMac();
     
     // Reset selection to top of the list
     selectedIndex = 0;
     currentPage = 0;
     
-    // Recalculate items per page in case the screen size has changed
-    itemsPerPage = calculateItemsPerPage();
+    // Scans and quick pairing need the current target to stay put
+    ps5Controller->holdBondRotation(true);
     
     // Auto-start scanning only if this is the first activation and there's no saved MAC
     if (isFirstActivation && !hasSavedMac) {
@@ -131,180 +150,155 @@ void ConnectionScreen::activate() {
 }
 
 void ConnectionScreen::deactivate() {
-    try {
-        // Stop scanning if in progress
-        if (isScanning) {
-            // Mark scanning as finished
-            isScanning = false;
-            activeConnectionScreen = nullptr;
-            
-            // Stop discovery by setting a 0-duration scan with empty callback
-            SerialBT.discoverAsync(empty_cb, 0);
-            
-            Serial.println("Scan canceled during deactivation");
-        }
-    } catch (...) {
-        Serial.println("Error in deactivate");
+    // Stop scanning if in progress, or drop one about to start
+    if (scanState == SCAN_RUNNING) {
+        stopDiscovery();
+        LOG_I(LOG_CONNECT, "Scan canceled during deactivation");
     }
+    scanState = SCAN_IDLE;
+    dismissDialog();
+    ps5Controller->holdBondRotation(false);
 }
 
-void ConnectionScreen::update() {
-    // Yield CPU time to prevent watchdog timeout
-    yield();
+void ConnectionScreen::update(const UiSnapshot& snapshot) {
+    // A scan waiting for Bluetooth to settle starts once it has
+    if (scanState == SCAN_SETTLING && millis() - scanStateSince >= BT_SETTLE_MS) {
+        beginDiscovery();
+    }
     
-    // Check if scan has timed out
-    if (isScanning && millis() - scanStartTime > SCAN_DURATION_MS) {
-        try {
-            // Mark scanning as finished first
-            isScanning = false;
-            
-            // Clear callback reference
-            activeConnectionScreen = nullptr;
-            
-            // Stop discovery by setting a 0-duration scan with empty callback
-            SerialBT.discoverAsync(empty_cb, 0);
-            
-            // Display message to user about connecting to the controllers
-            Serial.println("Finished scan phase, found " + String(devices.size()) + " devices");
-                
-            // Update display to show results
-            setNeedsRedraw();
-            
-        } catch (...) {
-            // Catch any exceptions to prevent crashes
-            Serial.println("Error stopping PS5 discovery");
-            isScanning = false;
+    // Take over the results the Bluetooth task found since the last frame;
+    // ones arriving after the scan stopped are discarded
+    DiscoveryRecord record;
+    while (discoveryQueue.pop(record)) {
+        if (scanState == SCAN_RUNNING) {
+            addDevice(record);
         }
     }
     
-    // Yield some time back to the system to prevent watchdog timeouts
-    delay(5);
+    // Quick pair stops at the first confirmed DualSense
+    const DeviceEntry* match = quickPairFound ? devices.find(quickPairMac) : nullptr;
+    if (scanState == SCAN_RUNNING && quickPair && match != nullptr) {
+        const DeviceEntry& device = *match;
+        quickPair = false;
+        stopDiscovery();
+        
+        LOG_I(LOG_CONNECT, "Quick pair: %s (%s) confirmed after %lu ms",
+              device.name, device.address, millis() - quickPairStartTime);
+        connectToDevice(device, quickPairStartTime);
+        return;
+    }
     
-    // Draw screen if needed
-    if (needsRedraw()) {
-        drawScreen();
+    // Check if scan has timed out
+    if (scanState == SCAN_RUNNING && millis() - scanStartTime > SCAN_DURATION_MS) {
+        stopDiscovery();
+        
+        // Display message to user about connecting to the controllers
+        LOG_I(LOG_CONNECT, "Finished scan phase, found %u devices (%lu results dropped)",
+              (unsigned)devices.size(), (unsigned long)discoveryQueue.getDropped());
+        
+        // Nothing confirmed: fall back to the full list
+        if (quickPair) {
+            LOG_I(LOG_CONNECT, "Quick pair found no DualSense, showing all devices");
+            quickPair = false;
+        }
     }
+    
+    // Only rows and labels that changed are drawn
+    drawScreen();
 }
 
 void ConnectionScreen::handleButton(uint8_t button) {
-    // Not used in this class as button handling is done in main.cpp
+    switch (button) {
+        case UI_BUTTON_SELECT:
+            connectToSelected();
+            break;
+        case UI_BUTTON_NEXT:
+            selectNext();
+            break;
+        case UI_BUTTON_PREVIOUS:
+            selectPrevious();
+            break;
+    }
 }
 
-bool ConnectionScreen::isLikelyPS5Controller(const String& name, const String& address) const {
-    // Check name for keywords
-    if (name.indexOf("DualSense") >= 0 || 
-        name.indexOf("Wireless Controller") >= 0 ||
-        name.indexOf("Sony") >= 0) {
-        return true;
+// Add a discovery result to the list, on the UI task
+void ConnectionScreen::addDevice(const DiscoveryRecord& record) {
+    // A constant amount of work: one hash probe, plus one index shift for new devices
+    bool changed;
+    DeviceEntry* entry = devices.add(record.address, record.name, record.rssi, false, changed);
+    if (entry == nullptr) {
+        LOG_D(LOG_CONNECT, "Device table full, ignoring %s", record.name);
+        return;
     }
     
-    // Common PS5 controller MAC prefixes (convert to uppercase for matching)
-    String upperAddress = address;
-    upperAddress.toUpperCase();
-    
-    const char* ps5Prefixes[] = {"48:18", "3C:01", "58:FA", "28:99", "40:1C"};
-    for (const char* prefix : ps5Prefixes) {
-        if (upperAddress.startsWith(prefix)) {
-            return true;
+    if (changed) {
+        formatDeviceRows(*entry);
+        
+        // Remember the first high-confidence match; update() connects to it
+        if (quickPair && !quickPairFound && entry->isConfirmedPS5) {
+            quickPairMac = entry->mac;
+            quickPairFound = true;
         }
+        
+        // Debug log
+        LOG_D(LOG_CONNECT, "Found device: %s (%s) - %s",
+              entry->name,
+              entry->address,
+              entry->isLikelyPS5 ? "Likely PS5" : "Other");
     }
-    
-    return false;
 }
 
-// Add device to the list, helper method
-void ConnectionScreen::addDeviceToList(const String& name, const String& address) {
-    // Only process if still scanning
-    if (!isScanning) {
-        return;
-    }
-    
-    // Convert Arduino String to std::string
-    std::string stdName = name.c_str();
-    std::string stdAddress = address.c_str();
+void ConnectionScreen::formatDeviceRows(DeviceEntry& device) const {
+    // Each character is approximately 6 pixels wide in size 1
+    int availableChars = min(M5.Lcd.width() / 6, WIDGET_LABEL_SIZE - 1);
     
-    // Check if this is a likely PS5 controller
-    bool isLikelyPS5 = isLikelyPS5Controller(name, address);
+    // The saved device is shown with a "SAVED: " prefix
+    const char* prefix = device.isSaved ? "SAVED: " : "";
+    availableChars -= strlen(prefix);
     
-    // Check if this device is already in our list (only if still scanning)
-    bool deviceExists = false;
-    for (const auto& existingDevice : devices) {
-        if (existingDevice.address == stdAddress) {
-            deviceExists = true;
-            break;
-        }
+    // Trim the name if it's too long
+    if ((int)strlen(device.name) > availableChars) {
+        snprintf(device.nameRow, sizeof(device.nameRow), "%s%.*s...", prefix, availableChars - 3, device.name);
+    } else {
+        snprintf(device.nameRow, sizeof(device.nameRow), "%s%s", prefix, device.name);
     }
     
-    if (!deviceExists) {
-        // Create device entry
-        BluetoothDevice btDevice;
-        btDevice.name = stdName;
-        btDevice.address = stdAddress;
-        btDevice.isLikelyPS5 = isLikelyPS5;
-        
-        // Add to list based on type
-        if (isLikelyPS5) {
-            // Find the position after any saved device but before other devices
-            auto it = devices.begin();
-            
-            // Skip the saved device if it exists
-            if (hasSavedMac && !devices.empty()) {
-                it++;
-            }
-            
-            // Find the first non-PS5 device
-            while (it != devices.end() && it->isLikelyPS5) {
-                it++;
-            }
-            
-            // Insert before that position
-            devices.insert(it, btDevice);
-        } else {
-            devices.push_back(btDevice);
-        }
-        
-        // Debug log
-        Serial.printf("Found device: %s (%s) - %s\n", 
-                    stdName.c_str(), 
-                    stdAddress.c_str(), 
-                    isLikelyPS5 ? "Likely PS5" : "Other");
-        
-        // Force redraw to show newly found device
-        setNeedsRedraw();
-    }
+    // Indent the MAC address
+    snprintf(device.addressRow, sizeof(device.addressRow), "  %s", device.address);
 }
 
-bool ConnectionScreen::loadSavedMac(BluetoothDevice& device) {
-    Preferences preferences;
-    if (preferences.begin("ps5bridge", true)) {
-        String savedMac = preferences.getString("mac", "");
-        preferences.end();
-        
-        if (savedMac.length() > 0) {
-            device.name = "Saved Controller";
-            device.address = savedMac.c_str();
-            device.isLikelyPS5 = true;
-            return true;
-        }
+int ConnectionScreen::getFixedItemCount() const {
+    // Quick pair and Scan always exist, Clear only with a saved device
+    return hasSavedMac ? 3 : 2;
+}
+
+int ConnectionScreen::getMenuItemCount() const {
+    return getFixedItemCount() + devices.size(); // All devices
+}
+
+bool ConnectionScreen::loadSavedMac() {
+    uint8_t address[6];
+    if (parseMac(ConfigStore::get().lastMac, address)) {
+        bool changed;
+        DeviceEntry* device = devices.add(address, "Saved Controller", DISCOVERY_RSSI_UNKNOWN, true, changed);
+        formatDeviceRows(*device);
+        return true;
     }
     return false;
 }
 
 void ConnectionScreen::clearSavedMac() {
-    // Remove saved MAC from preferences
-    Preferences preferences;
-    if (preferences.begin("ps5bridge", false)) {
-        preferences.remove("mac");
-        preferences.end();
-        Serial.println("Cleared saved MAC address");
-    }
+    // Remove the saved MAC from the settings
+    ConfigStore::setLastMac("");
+    LOG_I(LOG_CONNECT, "Cleared saved MAC address");
     
     // Update flags and display
     hasSavedMac = false;
     
     // Remove saved device from list if it exists
-    if (!devices.empty() && devices[0].name == "Saved Controller") {
-        devices.erase(devices.begin());
+    if (devices.size() > 0 && devices.get(0).isSaved) {
+        ps5Controller->requestForget(devices.get(0).address);
+        devices.remove(devices.get(0).mac);
     }
     
     // Reset selection
@@ -312,84 +306,100 @@ void ConnectionScreen::clearSavedMac() {
     currentPage = 0;
     
     // Stop scanning if in progress
-    if (isScanning) {
-        isScanning = false;
-        activeConnectionScreen = nullptr;
-        SerialBT.discoverAsync(empty_cb, 0);
+    if (scanState == SCAN_RUNNING) {
+        stopDiscovery();
     }
-    
-    // Force redraw
-    setNeedsRedraw();
+    scanState = SCAN_IDLE;
 }
 
-void ConnectionScreen::startScan() {
-    Serial.println("Starting Bluetooth Classic scan for PS5 controllers");
-    
-    // Make sure we're not scanning already
-    if (isScanning) {
-        // Stop scanning first
-        isScanning = false;
-        activeConnectionScreen = nullptr;
-        // Stop any existing discovery
-        SerialBT.discoverAsync(empty_cb, 0);
-        delay(100);
+void ConnectionScreen::startScan(bool quick) {
+    LOG_I(LOG_CONNECT, "Starting Bluetooth Classic %s for PS5 controllers", quick ? "quick pair" : "scan");
+    
+    pendingQuick = quick;
+    
+    // A running discovery is stopped first; the new one starts after the settle time
+    if (scanState == SCAN_RUNNING) {
+        stopDiscovery();
+        scanState = SCAN_SETTLING;
+        scanStateSince = millis();
+        return;
     }
     
-    // Initialize Bluetooth if needed
+    // Initialize Bluetooth if needed, then let it settle the same way
     if (!btInitialized) {
-        if (SerialBT.begin("CrossTieConnectBridge", true)) {
-            btInitialized = true;
-            delay(100);  // Give time for BT to initialize
-        } else {
-            Serial.println("Failed to initialize Bluetooth");
+        BluetoothLock::take();
+        bool started = SerialBT.begin("CrossTieConnectBridge", true);
+        BluetoothLock::give();
+        if (!started) {
+            LOG_E(LOG_CONNECT, "Failed to initialize Bluetooth");
             return;
         }
+        btInitialized = true;
+        scanState = SCAN_SETTLING;
+        scanStateSince = millis();
+        return;
     }
     
+    beginDiscovery();
+}
+
+void ConnectionScreen::stopDiscovery() {
+    // Stop discovery by setting a 0-duration scan with empty callback
+    BluetoothLock::take();
+    SerialBT.discoverAsync(empty_cb, 0);
+    BluetoothLock::give();
+    scanState = SCAN_IDLE;
+}
+
+void ConnectionScreen::beginDiscovery() {
+    // The btlink task may be restarting the stack; settle again and retry
+    // rather than holding up the render task
+    if (!BluetoothLock::take(0)) {
+        scanState = SCAN_SETTLING;
+        scanStateSince = millis();
+        return;
+    }
+    scanState = SCAN_IDLE;
+    
     // We'll keep any saved device, but clear other discovered devices
-    if (hasSavedMac && !devices.empty()) {
-        BluetoothDevice savedDevice = devices[0];
-        devices.clear();
-        devices.push_back(savedDevice);
-    } else {
-        devices.clear();
+    devices.clear();
+    if (hasSavedMac) {
+        loadSavedMac();
     }
     
-    // Set this as the active connection screen for callback
-    activeConnectionScreen = this;
+    // Discard results left over from an earlier scan
+    DiscoveryRecord stale;
+    while (discoveryQueue.pop(stale)) {
+    }
     
     // Start device discovery with callback (10 seconds timeout)
     bool scanStarted = SerialBT.discoverAsync(bt_discovery_cb, 10);
+    BluetoothLock::give();
     
     if (!scanStarted) {
-        Serial.println("Failed to start Bluetooth scan");
+        LOG_E(LOG_CONNECT, "Failed to start Bluetooth scan");
         return;
     }
     
     // Update status
-    isScanning = true;
+    scanState = SCAN_RUNNING;
     scanStartTime = millis();
+    quickPair = pendingQuick;
+    quickPairFound = false;
     
     // Reset selection to first device if available
     selectedIndex = 0;
     currentPage = 0;
-    
-    // Force redraw
-    setNeedsRedraw();
 }
 
 ConnectionMenuItem ConnectionScreen::getSelectedItemType() const {
-    // Calculate count of menu items before devices
-    int menuItemCount = 1; // Scan button always exists
-    if (hasSavedMac) {
-        menuItemCount++; // Clear button
-    }
-    
     if (selectedIndex == 0) {
+        return ITEM_QUICK_PAIR;
+    } else if (selectedIndex == 1) {
         return ITEM_SCAN;
-    } else if (hasSavedMac && selectedIndex == 1) {
+    } else if (hasSavedMac && selectedIndex == 2) {
         return ITEM_CLEAR;
-    } else if (hasSavedMac && selectedIndex == 2 && !devices.empty()) {
+    } else if (hasSavedMac && selectedIndex == 3 && devices.size() > 0) {
         return ITEM_SAVED_MAC;
     } else {
         return ITEM_DEVICE;
@@ -400,6 +410,12 @@ void ConnectionScreen::connectToSelected() {
     ConnectionMenuItem itemType = getSelectedItemType();
     
     switch (itemType) {
+        case ITEM_QUICK_PAIR:
+            // Timed from the button press to the first report
+            quickPairStartTime = millis();
+            startScan(true);
+            return;
+            
         case ITEM_SCAN:
             startScan();
             return;
@@ -411,231 +427,126 @@ void ConnectionScreen::connectToSelected() {
         case ITEM_SAVED_MAC:
         case ITEM_DEVICE: {
             // Calculate index into devices array based on menu structure
-            int deviceIndex;
-            if (hasSavedMac) {
-                deviceIndex = selectedIndex - 2; // Adjust for Scan and Clear buttons
-            } else {
-                deviceIndex = selectedIndex - 1; // Adjust for Scan button only
-            }
+            int deviceIndex = selectedIndex - getFixedItemCount();
             
             // Check bounds
             if (deviceIndex < 0 || deviceIndex >= devices.size()) {
                 return;
             }
             
-            std::string address = devices[deviceIndex].address;
+            const char* address = devices.get(deviceIndex).address;
             
             // Check if this is a partial MAC address (ends with 00:00:00)
-            if (address.find("00:00:00") != std::string::npos) {
-                M5.Lcd.fillScreen(BLACK);
-                M5.Lcd.setCursor(0, 10);
-                M5.Lcd.setTextSize(2);
-                M5.Lcd.setTextColor(RED);
-                M5.Lcd.println("Warning: Partial MAC");
-                M5.Lcd.println("Address detected!");
-                M5.Lcd.println("");
-                M5.Lcd.setTextColor(WHITE);
-                M5.Lcd.println("Check your controller");
-                M5.Lcd.println("for the full MAC addr:");
-                M5.Lcd.setTextColor(YELLOW);
-                M5.Lcd.println(address.substr(0, 8).c_str());
-                M5.Lcd.println("XX:XX:XX");
-                M5.Lcd.setTextColor(WHITE);
-                M5.Lcd.println("");
-                M5.Lcd.println("Edit Config.h with");
-                M5.Lcd.println("the complete address");
+            if (strstr(address, "00:00:00") != nullptr) {
+                // Shown over the menu until it times out or a button is pressed
+                char prefix[WIDGET_LABEL_SIZE];
+                snprintf(prefix, sizeof(prefix), "%.8s:XX:XX:XX", address);
                 
-                delay(5000); // Show this message for 5 seconds
-                drawScreen();
+                DialogWidget& dialog = openDialog(PARTIAL_MAC_DIALOG_MS);
+                dialog.addLine("Warning: Partial MAC", RED);
+                dialog.addLine("Address detected!", RED);
+                dialog.addLine("", WHITE);
+                dialog.addLine("Check your controller", WHITE);
+                dialog.addLine("for the full MAC addr:", WHITE);
+                dialog.addLine(prefix, YELLOW);
+                dialog.addLine("", WHITE);
+                dialog.addLine("Edit Config.h with", WHITE);
+                dialog.addLine("the complete address", WHITE);
                 return;
             }
             
-            // Save the MAC address and connect
-            ps5Controller->setMacAddress(address.c_str());
-            ps5Controller->reconnect();
-            
-            // Exit the connection screen and switch to status screen
-            deactivate();
-            
-            // Switch to status screen to show connection progress
-            screenManager.switchToScreen(SCREEN_STATUS);
+            connectToDevice(devices.get(deviceIndex), millis());
             break;
         }
     }
 }
 
-void ConnectionScreen::drawScreen() {
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setCursor(0, 0);
-    M5.Lcd.setTextSize(1);
-    
-    // Draw title
-    M5.Lcd.setTextColor(YELLOW);
-    M5.Lcd.println(" Bluetooth Menu");
-    
-    // Show scan status
-    if (isScanning) {
-        M5.Lcd.setTextColor(GREEN);
-        M5.Lcd.print(" Scanning: ");
-        M5.Lcd.print(String((SCAN_DURATION_MS - (millis() - scanStartTime)) / 1000));
-        M5.Lcd.println("s");
-    } else {
-        M5.Lcd.setTextColor(WHITE);
-        M5.Lcd.println("");
-    }
+void ConnectionScreen::connectToDevice(const DeviceEntry& device, unsigned long startTime) {
+    // Save the MAC address and connect (carried out by the main loop)
+    ps5Controller->requestConnect(device.address, startTime);
     
-    M5.Lcd.println();
+    // Exit the connection screen and switch to status screen
+    deactivate();
     
-    // Calculate total menu items
-    int totalMenuItems = 1; // Scan button always exists
-    if (hasSavedMac) {
-        totalMenuItems++; // Clear button
+    // Switch to status screen to show connection progress
+    screenManager.switchToScreen(SCREEN_STATUS);
+}
+
+void ConnectionScreen::drawScreen() {
+    // Show scan status; the label only repaints when the seconds change
+    if (scanState == SCAN_SETTLING) {
+        countdown.setText(" Starting Bluetooth...");
+    } else if (scanState == SCAN_RUNNING) {
+        unsigned long elapsed = millis() - scanStartTime;
+        unsigned long remaining = elapsed < SCAN_DURATION_MS ? (SCAN_DURATION_MS - elapsed) / 1000 : 0;
+        char text[WIDGET_LABEL_SIZE];
+        snprintf(text, sizeof(text), quickPair ? " Quick pair: %lus" : " Scanning: %lus", remaining);
+        countdown.setText(text);
+    } else {
+        countdown.setText("");
     }
-    totalMenuItems += devices.size(); // All devices
     
-    // Calculate total pages
+    // Calculate total menu items and pages
+    int totalMenuItems = getMenuItemCount();
     int totalPages = (totalMenuItems + itemsPerPage - 1) / itemsPerPage;
     
-    // Calculate items to show on current page
+    // Map the items of the current page onto the list rows (2 rows per item)
     int startIdx = currentPage * itemsPerPage;
-    int endIdx = min(startIdx + itemsPerPage, totalMenuItems);
-    
-    // Draw menu items (2 lines per item)
-    for (int i = startIdx; i < endIdx; i++) {
+    for (int slot = 0; slot < itemsPerPage; slot++) {
+        int i = startIdx + slot;
+        int row = slot * 2;
         bool isSelected = (i == selectedIndex);
+        uint16_t background = isSelected ? WHITE : BLACK;
         
-        // Special menu items
-        if (i == 0) {
+        if (i >= totalMenuItems) {
+            // Past the end of the menu
+            list.setRow(row, "", WHITE);
+            list.setRow(row + 1, "", WHITE);
+        } else if (i == 0) {
+            // Quick pair button
+            list.setRow(row, "[QUICK PAIR]", isSelected ? BLACK : GREEN, background);
+            list.setRow(row + 1, "", BLACK, background);
+        } else if (i == 1) {
             // Scan button
-            if (isSelected) {
-                M5.Lcd.fillRect(0, M5.Lcd.getCursorY(), M5.Lcd.width(), ITEM_HEIGHT, WHITE);
-                M5.Lcd.setTextColor(BLACK, WHITE);
-            } else {
-                M5.Lcd.setTextColor(CYAN, BLACK);
-            }
-            
-            M5.Lcd.println("[SCAN FOR DEVICES]");
-            
-            // Second line (empty)
-            if (isSelected) {
-                M5.Lcd.fillRect(0, M5.Lcd.getCursorY(), M5.Lcd.width(), ITEM_HEIGHT, WHITE);
-            }
-            M5.Lcd.println();
-        } 
-        else if (hasSavedMac && i == 1) {
+            list.setRow(row, "[SCAN FOR DEVICES]", isSelected ? BLACK : CYAN, background);
+            list.setRow(row + 1, "", BLACK, background);
+        } else if (hasSavedMac && i == 2) {
             // Clear button
-            if (isSelected) {
-                M5.Lcd.fillRect(0, M5.Lcd.getCursorY(), M5.Lcd.width(), ITEM_HEIGHT, WHITE);
-                M5.Lcd.setTextColor(BLACK, WHITE);
-            } else {
-                M5.Lcd.setTextColor(RED, BLACK);
-            }
-            
-            M5.Lcd.println("[CLEAR SAVED DEVICE]");
-            
-            // Second line (empty)
-            if (isSelected) {
-                M5.Lcd.fillRect(0, M5.Lcd.getCursorY(), M5.Lcd.width(), ITEM_HEIGHT, WHITE);
-            }
-            M5.Lcd.println();
-        }
-        else {
+            list.setRow(row, "[CLEAR SAVED DEVICE]", isSelected ? BLACK : RED, background);
+            list.setRow(row + 1, "", BLACK, background);
+        } else {
             // Calculate device index based on menu structure
-            int deviceIndex;
-            if (hasSavedMac) {
-                deviceIndex = i - 2; // Adjust for Scan and Clear buttons
-            } else {
-                deviceIndex = i - 1; // Adjust for Scan button only
-            }
-            
-            // Check bounds
-            if (deviceIndex < 0 || deviceIndex >= devices.size()) {
-                continue;
-            }
-            
-            // Regular device entry
-            if (isSelected) {
-                // Draw selection background for the first line
-                M5.Lcd.fillRect(0, M5.Lcd.getCursorY(), M5.Lcd.width(), ITEM_HEIGHT, WHITE);
-                M5.Lcd.setTextColor(BLACK, WHITE);
-            } else {
-                // Saved device in YELLOW, PS5 devices in WHITE, others in LIGHTGREY
-                if (deviceIndex == 0 && hasSavedMac) {
-                    M5.Lcd.setTextColor(YELLOW, BLACK);
-                } else if (devices[deviceIndex].isLikelyPS5) {
-                    M5.Lcd.setTextColor(WHITE, BLACK);
-                } else {
-                    M5.Lcd.setTextColor(LIGHTGREY, BLACK);
-                }
-            }
+            int deviceIndex = i - getFixedItemCount();
+            const DeviceEntry& device = devices.get(deviceIndex);
             
-            // First line: Device name
+            // Saved device in YELLOW, PS5 devices in WHITE, others in LIGHTGREY
+            uint16_t nameColor = LIGHTGREY;
             if (deviceIndex == 0 && hasSavedMac) {
-                M5.Lcd.print("SAVED: ");
-            }
-            
-            // Get the device name and trim it if needed to fit on screen
-            String deviceName = devices[deviceIndex].name.c_str();
-            
-            // Calculate available width 
-            // Each character is approximately 6 pixels wide in size 1
-            int availableChars = M5.Lcd.width() / 6;
-            
-            // If this is the saved device with "SAVED: " prefix, reduce available chars
-            if (deviceIndex == 0 && hasSavedMac) {
-                availableChars -= 7; // Account for "SAVED: " (7 chars)
-            }
-            
-            // Trim the name if it's too long
-            if (deviceName.length() > availableChars) {
-                deviceName = deviceName.substring(0, availableChars - 3) + "...";
+                nameColor = YELLOW;
+            } else if (device.isLikelyPS5) {
+                nameColor = WHITE;
             }
             
-            M5.Lcd.print(deviceName);
-            M5.Lcd.println();
-            
-            // Second line: MAC address
-            if (isSelected) {
-                // Draw selection background for the second line
-                M5.Lcd.fillRect(0, M5.Lcd.getCursorY(), M5.Lcd.width(), ITEM_HEIGHT, WHITE);
-                M5.Lcd.setTextColor(BLACK, WHITE);
-            } else {
-                M5.Lcd.setTextColor(BLUE, BLACK);
-            }
-            
-            // Indent the MAC address
-            M5.Lcd.print("  ");
-            M5.Lcd.print(devices[deviceIndex].address.c_str());
-            M5.Lcd.println();
+            // Device name, then its MAC address
+            list.setRow(row, device.nameRow, isSelected ? BLACK : nameColor, background);
+            list.setRow(row + 1, device.addressRow, isSelected ? BLACK : BLUE, background);
         }
-        
-        // Add a small gap between items
-        M5.Lcd.println();
     }
     
     // Show pagination indication if needed
     if (totalPages > 1) {
-        M5.Lcd.setTextColor(WHITE);
-        M5.Lcd.printf("Page %d/%d", currentPage + 1, totalPages);
-        M5.Lcd.println();
+        char text[WIDGET_LABEL_SIZE];
+        snprintf(text, sizeof(text), "Page %d/%d", currentPage + 1, totalPages);
+        page.setText(text);
+    } else {
+        page.setText("");
     }
     
-    // Show navigation instructions
-    M5.Lcd.setCursor(0, M5.Lcd.height() - 20);
-    M5.Lcd.setTextColor(CYAN);
-    M5.Lcd.println("A: Select Option");
-    M5.Lcd.println("B: Next | Long B: Prev");
-    
-    redrawNeeded = false;
+    renderWidgets(M5.Lcd);
 }
 
 void ConnectionScreen::selectNext() {
-    // Calculate total menu items
-    int totalMenuItems = 1; // Scan button always exists
-    if (hasSavedMac) {
-        totalMenuItems++; // Clear button
-    }
-    totalMenuItems += devices.size(); // All devices
+    int totalMenuItems = getMenuItemCount();
     
     // Move to next item
     selectedIndex = (selectedIndex + 1) % totalMenuItems;
@@ -645,17 +556,10 @@ void ConnectionScreen::selectNext() {
     if (newPage != currentPage) {
         currentPage = newPage;
     }
-    
-    setNeedsRedraw();
 }
 
 void ConnectionScreen::selectPrevious() {
-    // Calculate total menu items
-    int totalMenuItems = 1; // Scan button always exists
-    if (hasSavedMac) {
-        totalMenuItems++; // Clear button
-    }
-    totalMenuItems += devices.size(); // All devices
+    int totalMenuItems = getMenuItemCount();
     
     // Move to previous item
     selectedIndex = (selectedIndex + totalMenuItems - 1) % totalMenuItems;
@@ -665,8 +569,6 @@ void ConnectionScreen::selectPrevious() {
     if (newPage != currentPage) {
         currentPage = newPage;
     }
-    
-    setNeedsRedraw();
 }
 
 void ConnectionScreen::saveSelectedDevice() {
@@ -674,20 +576,11 @@ void ConnectionScreen::saveSelectedDevice() {
     
     if (itemType == ITEM_DEVICE || itemType == ITEM_SAVED_MAC) {
         // Calculate device index based on menu structure
-        int deviceIndex;
-        if (hasSavedMac) {
-            deviceIndex = selectedIndex - 2; // Adjust for Scan and Clear buttons
-        } else {
-            deviceIndex = selectedIndex - 1; // Adjust for Scan button only
-        }
+        int deviceIndex = selectedIndex - getFixedItemCount();
         
         // Check bounds
         if (deviceIndex >= 0 && deviceIndex < devices.size()) {
-            Preferences preferences;
-            if (preferences.begin("ps5bridge", false)) {
-                preferences.putString("mac", devices[deviceIndex].address.c_str());
-                preferences.end();
-            }
+            ConfigStore::setLastMac(devices.get(deviceIndex).address);
         }
     }
 } 
\ No newline at end of file
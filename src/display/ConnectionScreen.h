@@ -23,27 +23,28 @@
 #pragma once
 
 #include <M5StickCPlus2.h>
-#include <vector>
-#include <string>
 #include <ps5Controller.h>  // Direct include for PS5Controller
 #include "Screen.h"
+#include "DiscoveryQueue.h"
+#include "DeviceTable.h"
 #include "../controllers/PS5Controller.h"
 
-// Structure to hold Bluetooth device information
-struct BluetoothDevice {
-    std::string name;
-    std::string address;
-    bool isLikelyPS5;  // Flag to indicate if this is likely a PS5 controller
-};
-
 // Menu item types for ConnectionScreen
 enum ConnectionMenuItem {
+    ITEM_QUICK_PAIR,  // Scan and connect to the first confirmed DualSense
     ITEM_SCAN,        // Scan for devices
     ITEM_CLEAR,       // Clear saved MAC
     ITEM_SAVED_MAC,   // Saved MAC address entry
     ITEM_DEVICE       // Regular device entry
 };
 
+// Discovery progress; each step returns at once and update() moves it on
+enum ScanState {
+    SCAN_IDLE,      // No discovery running
+    SCAN_SETTLING,  // Waiting BT_SETTLE_MS after stopping or starting Bluetooth
+    SCAN_RUNNING    // Discovery running, results arrive through the queue
+};
+
 // Screen for Bluetooth device selection
 class ConnectionScreen : public Screen {
 public:
@@ -53,11 +54,13 @@ public:
     // Screen interface
     void activate() override;
     void deactivate() override;
-    void update() override;
+    void update(const UiSnapshot& snapshot) override;
     void handleButton(uint8_t button) override;
     
-    // Start scanning for Bluetooth devices
-    void startScan();
+    // Start scanning for Bluetooth devices; a quick scan stops and connects
+    // at the first confirmed DualSense and only shows the list otherwise.
+    // Returns at once, the discovery itself starts from update()
+    void startScan(bool quick = false);
     
     // Connect to selected device
     void connectToSelected();
@@ -66,50 +69,77 @@ public:
     void selectNext();
     void selectPrevious();
     
-    // Add device to the list (called from discovery callback)
-    void addDeviceToList(const String& name, const String& address);
-    
     // Set if this is first activation (for auto-scanning on startup)
     void setFirstActivation(bool isFirst);
     
 private:
-    // Draw the screen content
+    // Refresh the widgets from the menu state and draw what changed
     void drawScreen();
     
+    // Start the discovery once the settle time has passed
+    void beginDiscovery();
+    
+    // Stop a running discovery
+    void stopDiscovery();
+    
+    // Add a discovery result to the list (drained from the discovery queue)
+    void addDevice(const DiscoveryRecord& record);
+    
+    // Fill in the list rows of a device
+    void formatDeviceRows(DeviceEntry& device) const;
+    
+    // Quick pair, Scan, optional Clear, then devices
+    int getMenuItemCount() const;
+    int getFixedItemCount() const;
+    
+    // Hand the device to the controller and show the status screen
+    void connectToDevice(const DeviceEntry& device, unsigned long startTime);
+    
     // Save selected device to preferences
     void saveSelectedDevice();
     
     // Clear the saved MAC address
     void clearSavedMac();
     
-    // Load saved MAC from preferences
-    bool loadSavedMac(BluetoothDevice& device);
+    // Add the saved MAC from preferences to the device table
+    bool loadSavedMac();
     
     // Check what type of menu item is selected
     ConnectionMenuItem getSelectedItemType() const;
     
-    // Check if this is a likely PS5 controller by name/address
-    bool isLikelyPS5Controller(const String& name, const String& address) const;
-    
     // Calculate how many items can be displayed per page based on screen size
     int calculateItemsPerPage() const;
     
     PS5Controller* ps5Controller;
-    std::vector<BluetoothDevice> devices;
+    DeviceTable devices;
     int selectedIndex;
-    bool isScanning;
+    ScanState scanState;
+    unsigned long scanStateSince; // Entry into the current scan state
+    bool pendingQuick;            // Quick pair requested, applied when discovery starts
     unsigned long scanStartTime;
     bool useActiveScanning; // Flag to alternate between active and passive scanning
+    bool quickPair;         // Current scan is a quick pair
+    bool quickPairFound;    // A confirmed DualSense turned up during the quick pair
+    uint64_t quickPairMac;
+    unsigned long quickPairStartTime; // Button press that started the quick pair
     bool isFirstActivation; // Flag to indicate if this is the first time the screen is activated
     bool hasSavedMac;       // Flag to indicate if there is a saved MAC
     
     // Constants
-    static const int MAX_DEVICES = 50; // Increased from 10 to 50 to allow more devices to be found
     static const int SCAN_DURATION_MS = 10000; // 10 seconds for scan
     int currentPage;
     
     // Display parameters
-    static const int ITEM_HEIGHT = 12;    // Height of a single line
-    static const int ITEM_GAP = 8;        // Gap between items
+    static const int ITEM_HEIGHT = 12;    // Height of a single line, two lines per item
+    static const int HEADER_HEIGHT = 24;  // Title and scan countdown
+    static const int FOOTER_HEIGHT = 32;  // Page indicator and instructions
     int itemsPerPage;                     // Dynamically calculated items per page
+    
+    // Widgets; the list only repaints rows whose text, color or selection changed
+    LabelWidget title;
+    LabelWidget countdown;
+    ListWidget list;
+    LabelWidget page;
+    LabelWidget helpSelect;
+    LabelWidget helpNavigate;
 }; 
\ No newline at end of file
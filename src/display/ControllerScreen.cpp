@@ -21,443 +21,176 @@
  */
 
 
+
 #include "ControllerScreen.h"
 #include "../Config.h"
-#include "../channels/ChannelManager.h"
+#include "../utils/Log.h"
 
-ControllerScreen::ControllerScreen(Controller* controller, ChannelManager* channelManager) : 
-    Screen(),
-    controller(controller),
-    channelManager(channelManager),
-    prevLX(0), prevLY(0), prevRX(0), prevRY(0),
-    prevL2(0), prevR2(0) {
-}
+// Layout anchors, the panel is in portrait orientation
+static int centerX() { return M5.Lcd.width() / 2; }
+static int centerY() { return M5.Lcd.height() / 2; }
 
-void ControllerScreen::activate() {
-    // Mark as needing redraw
-    setNeedsRedraw();
-    
-    // Force drawing of all elements by marking their previous values as different
-    // This ensures they'll be drawn right away, even if there's no controller input yet
-    prevLX = 1000; // Use an invalid value to force drawing
-    prevLY = 1000;
-    prevRX = 1000;
-    prevRY = 1000;
-    prevL2 = -1;   // Use an invalid value to force drawing
-    prevR2 = -1;
-}
+// Shoulder buttons and triggers share one geometry
+static const int BAR_WIDTH = 30;
+static const int BAR_HEIGHT = 8;
+static const int BAR_SPACING = 5;
 
-void ControllerScreen::deactivate() {
-    // Nothing specific needed when deactivating
-}
+// Face buttons
+static const int BUTTON_RADIUS = 8;
+static const int BUTTON_SPACING = 16;
 
-void ControllerScreen::update() {
-    // Get values from ChannelManager instead of controller
-    // Map CRSF values (172-1811) to controller range (-128 to 127 for sticks, 0-255 for triggers)
-    int lx = map(channelManager->getChannel(0), CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
-    int ly = map(channelManager->getChannel(2), CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
-    int rx = map(channelManager->getChannel(3), CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
-    int ry = map(channelManager->getChannel(1), CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
+#define FACE_BUTTON(dx, dy, onColor, symbol) \
+    ButtonDotWidget::SHAPE_CIRCLE, centerX() + 33 + (dx) - BUTTON_RADIUS, centerY() + 50 + (dy) - BUTTON_RADIUS, \
+    BUTTON_RADIUS * 2 + 1, BUTTON_RADIUS * 2 + 1, TFT_DARKGREY, onColor, symbol
 
-    int l2 = map(channelManager->getChannel(6), CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-    int r2 = map(channelManager->getChannel(7), CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-    
-    int centerX = M5.Lcd.width() / 2;
-    int centerY = M5.Lcd.height() / 2;
-    
-    // Check if we need to do a full redraw
-    if (redrawNeeded) {
-        // Clear the screen
-        M5.Lcd.clear();
-        
-        // Draw title
-        M5.Lcd.setTextColor(TFT_WHITE);
-        M5.Lcd.setTextSize(1);
-        M5.Lcd.setTextDatum(TC_DATUM);
-        M5.Lcd.drawString("PS5 Controller", centerX, 5);
-        
-        // Force draw all UI elements
-        drawStick(centerX - 33, centerY - 60, lx, ly, 1000, 1000, TFT_CYAN);
-        drawStick(centerX + 33, centerY - 60, rx, ry, 1000, 1000, TFT_ORANGE);
-        drawShoulderButtons(centerX, centerY - 20);
-        drawTrigger(centerX, centerY, l2, r2, -1, -1, TFT_YELLOW);
-        drawDPad(centerX - 33, centerY + 50);
-        drawButtons(centerX + 33, centerY + 50);
-        
-        // Connection indicator
-        M5.Lcd.fillCircle(M5.Lcd.width() - 10, 10, 3, controller->isConnected() ? TFT_GREEN : TFT_RED);
-        
-        redrawNeeded = false;
-    } else {
-        // Draw the stick visuals
-        drawStick(centerX - 33, centerY - 60, lx, ly, prevLX, prevLY, TFT_CYAN);
-        drawStick(centerX + 33, centerY - 60, rx, ry, prevRX, prevRY, TFT_ORANGE);
-        
-        // Draw L1 and R1
-        drawShoulderButtons(centerX, centerY - 20);
-        
-        // Draw trigger bars
-        drawTrigger(centerX, centerY, l2, r2, prevL2, prevR2, TFT_YELLOW);
-        
-        // Draw button indicators and D-pad which need to update each frame
-        drawDPad(centerX - 33, centerY + 50);
-        drawButtons(centerX + 33, centerY + 50);
-        
-        // Connection indicator - redraw if connection state changes
-        static bool lastConnectionState = false;
-        bool currentConnectionState = controller->isConnected();
-        if (currentConnectionState != lastConnectionState) {
-            M5.Lcd.fillCircle(M5.Lcd.width() - 10, 10, 3, currentConnectionState ? TFT_GREEN : TFT_RED);
-            lastConnectionState = currentConnectionState;
-        }
+ControllerScreen::ControllerScreen(FlightRecorder* recorder) : 
+    Screen(),
+    recorder(recorder),
+    title(0, 5, M5.Lcd.width(), 8, TC_DATUM, 1, TFT_WHITE),
+    l1Label(centerX() - BAR_WIDTH - BAR_SPACING, centerY() - 30, BAR_WIDTH, 8, TC_DATUM, 1, TFT_WHITE),
+    r1Label(centerX() + BAR_SPACING, centerY() - 30, BAR_WIDTH, 8, TC_DATUM, 1, TFT_WHITE),
+    l2Label(centerX() - BAR_WIDTH - BAR_SPACING, centerY() - 10, BAR_WIDTH, 8, TC_DATUM, 1, TFT_WHITE),
+    r2Label(centerX() + BAR_SPACING, centerY() - 10, BAR_WIDTH, 8, TC_DATUM, 1, TFT_WHITE),
+    leftStick(centerX() - 33, centerY() - 60, 15, TFT_CYAN),
+    rightStick(centerX() + 33, centerY() - 60, 15, TFT_ORANGE),
+    l1(ButtonDotWidget::SHAPE_BOX, centerX() - BAR_WIDTH - BAR_SPACING, centerY() - 20, BAR_WIDTH, BAR_HEIGHT, TFT_DARKGREY, TFT_GREEN),
+    r1(ButtonDotWidget::SHAPE_BOX, centerX() + BAR_SPACING, centerY() - 20, BAR_WIDTH, BAR_HEIGHT, TFT_DARKGREY, TFT_GREEN),
+    l2(centerX() - BAR_WIDTH - BAR_SPACING, centerY(), BAR_WIDTH, BAR_HEIGHT, TFT_YELLOW),
+    r2(centerX() + BAR_SPACING, centerY(), BAR_WIDTH, BAR_HEIGHT, TFT_YELLOW),
+    dpad(centerX() - 33, centerY() + 50, 15, 10, TFT_WHITE),
+    triangle(FACE_BUTTON(0, -BUTTON_SPACING, TFT_GREEN, "^")),
+    circle(FACE_BUTTON(BUTTON_SPACING, 0, TFT_RED, "O")),
+    cross(FACE_BUTTON(0, BUTTON_SPACING, TFT_BLUE, "X")),
+    square(FACE_BUTTON(-BUTTON_SPACING, 0, TFT_MAGENTA, "□")),
+    link(ButtonDotWidget::SHAPE_CIRCLE, M5.Lcd.width() - 13, 7, 7, 7, TFT_RED, TFT_GREEN),
+    canvas(&M5.Lcd),
+    canvasReady(false) {
+    
+    title.setText("PS5 Controller");
+    l1Label.setText("L1");
+    r1Label.setText("R1");
+    l2Label.setText("L2");
+    r2Label.setText("R2");
+    
+    Widget* all[] = {
+        &title, &l1Label, &r1Label, &l2Label, &r2Label,
+        &leftStick, &rightStick, &l1, &r1, &l2, &r2,
+        &dpad, &triangle, &circle, &cross, &square, &link
+    };
+    for (Widget* widget : all) {
+        addWidget(widget);
     }
     
-    // Update previous values
-    prevLX = lx;
-    prevLY = ly;
-    prevRX = rx;
-    prevRY = ry;
-    prevL2 = l2;
-    prevR2 = r2;
-}
-
-void ControllerScreen::handleButton(uint8_t button) {
-    // No button handling in controller screen yet
+    memset(&stats, 0, sizeof(stats));
 }
 
-void ControllerScreen::drawStick(int x, int y, int valueX, int valueY, int prevX, int prevY, uint16_t color) {
-    // Define smaller stick radius for portrait mode
-    const int stickRadius = 15;
-    
-    // Map PS5 stick values (-128 to 127) to our display area
-    int posX = map(valueX, -128, 127, -stickRadius, stickRadius);
-    int posY = map(valueY, -128, 127, stickRadius, -stickRadius); // Invert Y axis
-    
-    int prevPosX = map(prevX, -128, 127, -stickRadius, stickRadius);
-    int prevPosY = map(prevY, -128, 127, stickRadius, -stickRadius);
+void ControllerScreen::activate() {
+    // Mark as needing redraw, which repaints every widget
+    setNeedsRedraw();
     
-    // Only redraw if position changed or forced redraw
-    if (posX != prevPosX || posY != prevPosY || prevX == 1000 || prevY == 1000 || redrawNeeded) {
-        // Clear previous position if needed and valid
-        if (prevX != 0 && prevY != 0 && prevX != 1000 && prevY != 1000) {
-            M5.Lcd.fillCircle(x + prevPosX, y + prevPosY, 5, TFT_BLACK);
+#if !CONTROLLER_SCREEN_DIRECT
+    // Full-screen sprite, only held while this screen is shown. DMA cannot read
+    // from PSRAM, so it has to live in internal RAM.
+    if (!canvasReady) {
+        canvas.setColorDepth(16);
+        canvas.setPsram(false);
+        canvasReady = canvas.createSprite(M5.Lcd.width(), M5.Lcd.height()) != nullptr;
+        if (!canvasReady) {
+            LOG_W(LOG_DISPLAY, "No memory for controller sprite, drawing directly");
         }
-        
-        // Draw outer circle
-        M5.Lcd.drawCircle(x, y, stickRadius, TFT_DARKGREY);
-        
-        // Draw position marker
-        M5.Lcd.fillCircle(x + posX, y + posY, 5, color);
-        
-        // Draw crosshair
-        M5.Lcd.drawFastHLine(x - stickRadius, y, stickRadius * 2, TFT_DARKGREY);
-        M5.Lcd.drawFastVLine(x, y - stickRadius, stickRadius * 2, TFT_DARKGREY);
     }
+#endif
+    
+    memset(&stats, 0, sizeof(stats));
+    stats.since = millis();
 }
 
-void ControllerScreen::drawTrigger(int x, int y, int l2Value, int r2Value, int prevL2, int prevR2, uint16_t color) {
-    // Sized for portrait display
-    const int triggerWidth = 30; // Increased width
-    const int triggerHeight = 8;
-    const int TRIGGER_SPACING = 5;
-    
-    // Calculate positions
-    int leftX = x - triggerWidth - TRIGGER_SPACING;
-    int rightX = x + TRIGGER_SPACING;
-    
-    // Only redraw if values changed or forced redraw
-    if (l2Value != prevL2 || r2Value != prevR2 || prevL2 < 0 || prevR2 < 0 || redrawNeeded) {
-        int l2Width = map(l2Value, 0, 255, 0, triggerWidth);
-        int r2Width = map(r2Value, 0, 255, 0, triggerWidth);
-        
-        // Clear previous L2 if needed
-        if (prevL2 >= 0) {
-            int prevL2Width = map(prevL2, 0, 255, 0, triggerWidth);
-            if (prevL2Width > l2Width) {
-                M5.Lcd.fillRect(leftX, y, prevL2Width, triggerHeight, TFT_BLACK);
-            }
-        }
-        
-        // Clear previous R2 if needed
-        if (prevR2 >= 0) {
-            int prevR2Width = map(prevR2, 0, 255, 0, triggerWidth);
-            if (prevR2Width > r2Width) {
-                M5.Lcd.fillRect(rightX, y, prevR2Width, triggerHeight, TFT_BLACK);
-            }
-        }
-        
-        // Draw L2 border and fill
-        M5.Lcd.drawRect(leftX, y, triggerWidth, triggerHeight, TFT_DARKGREY);
-        if (l2Width > 0) {
-            M5.Lcd.fillRect(leftX, y, l2Width, triggerHeight, color);
-        }
-        
-        // Draw R2 border and fill
-        M5.Lcd.drawRect(rightX, y, triggerWidth, triggerHeight, TFT_DARKGREY);
-        if (r2Width > 0) {
-            M5.Lcd.fillRect(rightX, y, r2Width, triggerHeight, color);
-        }
-        
-        // Label the triggers
-        M5.Lcd.setTextSize(1);
-        M5.Lcd.setTextColor(TFT_WHITE);
-        M5.Lcd.setTextDatum(TC_DATUM);
-        M5.Lcd.drawString("L2", leftX + triggerWidth/2, y - 10);
-        M5.Lcd.drawString("R2", rightX + triggerWidth/2, y - 10);
+void ControllerScreen::deactivate() {
+    // Give the sprite memory back
+    if (canvasReady) {
+        canvas.deleteSprite();
+        canvasReady = false;
     }
 }
 
-void ControllerScreen::drawShoulderButtons(int centerX, int centerY) {
-    // Get channel values for L1 and R1 (assuming channels 4 and 5 for L1/R1)
-    uint16_t l1Value = channelManager->getChannel(4);
-    uint16_t r1Value = channelManager->getChannel(5);
-    
-    // Match dimensions with L2/R2 triggers
-    const int buttonWidth = 30; // Same width as triggers
-    const int buttonHeight = 8; // Same height as triggers
-    const int BUTTON_SPACING = 5;
-    
-    // Calculate positions
-    int leftX = centerX - buttonWidth - BUTTON_SPACING;
-    int rightX = centerX + BUTTON_SPACING;
+void ControllerScreen::update(const UiSnapshot& snapshot) {
+    // Everything comes from the channels that are being transmitted
+    const uint16_t* channels = snapshot.channels;
     
-    // Calculate colors based on channel values
-    uint16_t l1Color, r1Color;
-    
-    // Interpolate color from gray to green based on channel value
-    if (l1Value <= CHANNEL_VALUE_MIN) {
-        l1Color = TFT_DARKGREY;
-    } else if (l1Value >= CHANNEL_VALUE_MAX) {
-        l1Color = TFT_GREEN;
-    } else {
-        // Linear interpolation between colors
-        uint8_t intensity = map(l1Value, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        
-        // Extract RGB components from TFT_DARKGREY (0x7BEF) and TFT_GREEN (0x07E0)
-        uint8_t r1 = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_GREEN >> 11) & 0x1F);
-        uint8_t g1 = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_GREEN >> 5) & 0x3F);
-        uint8_t b1 = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_GREEN & 0x1F);
-        
-        // Combine the components to get the interpolated color
-        l1Color = (r1 << 11) | (g1 << 5) | b1;
-    }
-    
-    // Same for R1
-    if (r1Value <= CHANNEL_VALUE_MIN) {
-        r1Color = TFT_DARKGREY;
-    } else if (r1Value >= CHANNEL_VALUE_MAX) {
-        r1Color = TFT_GREEN;
+    // Map CRSF values (172-1811) to controller range (-128 to 127 for sticks, 0-255 for triggers)
+    int lx = map(channels[0], CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
+    int ly = map(channels[2], CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
+    int rx = map(channels[3], CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
+    int ry = map(channels[1], CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, -128, 127);
+    
+    leftStick.setValue(lx, ly);
+    rightStick.setValue(rx, ry);
+    
+    // L1/R1 on channels 4-5, L2/R2 on channels 6-7
+    l1.setValue(channels[4]);
+    r1.setValue(channels[5]);
+    l2.setValue(map(channels[6], CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255));
+    r2.setValue(map(channels[7], CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255));
+    
+    // Face buttons on channels 8-11, D-pad on 12-15
+    cross.setValue(channels[8]);
+    circle.setValue(channels[9]);
+    square.setValue(channels[10]);
+    triangle.setValue(channels[11]);
+    dpad.setValue(channels[12], channels[13], channels[14], channels[15]);
+    
+    link.setValue(snapshot.connected ? CHANNEL_VALUE_MAX : CHANNEL_VALUE_MIN);
+    
+    // Only widgets whose value changed are drawn
+    unsigned long startTime = micros();
+    if (canvasReady) {
+        renderWidgets(canvas);
     } else {
-        // Linear interpolation between colors
-        uint8_t intensity = map(r1Value, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        
-        // Extract RGB components from TFT_DARKGREY (0x7BEF) and TFT_GREEN (0x07E0)
-        uint8_t r1 = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_GREEN >> 11) & 0x1F);
-        uint8_t g1 = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_GREEN >> 5) & 0x3F);
-        uint8_t b1 = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_GREEN & 0x1F);
-        
-        // Combine the components to get the interpolated color
-        r1Color = (r1 << 11) | (g1 << 5) | b1;
+        renderWidgets(M5.Lcd);
     }
-    
-    // Draw L1 and R1 buttons with color coding (not as progress bars)
-    M5.Lcd.fillRect(leftX, centerY, buttonWidth, buttonHeight, l1Color);
-    M5.Lcd.fillRect(rightX, centerY, buttonWidth, buttonHeight, r1Color);
-    
-    // Add borders for better visibility
-    M5.Lcd.drawRect(leftX, centerY, buttonWidth, buttonHeight, TFT_DARKGREY);
-    M5.Lcd.drawRect(rightX, centerY, buttonWidth, buttonHeight, TFT_DARKGREY);
-    
-    // Draw L1/R1 labels - match label position style with triggers
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextDatum(TC_DATUM);
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.drawString("L1", leftX + buttonWidth/2, centerY - 10);
-    M5.Lcd.drawString("R1", rightX + buttonWidth/2, centerY - 10);
+    endFrame(startTime);
 }
 
-void ControllerScreen::drawButtons(int centerX, int centerY) {
-    // Button size and spacing
-    const int BUTTON_RADIUS = 8; // Increased by 2 pixels
-    const int BUTTON_SPACING = 16; // Decreased by 2 pixels
-    
-    // Get button values from channelManager instead of controller
-    uint16_t squareValue = channelManager->getChannel(10);    // Channel 10: Square
-    uint16_t crossValue = channelManager->getChannel(8);      // Channel 8: Cross
-    uint16_t circleValue = channelManager->getChannel(9);     // Channel 9: Circle
-    uint16_t triangleValue = channelManager->getChannel(11);  // Channel 11: Triangle
-    
-    // Calculate colors based on channel values
-    uint16_t squareColor, crossColor, circleColor, triangleColor;
-    
-    // For Square (Channel 10) - interpolate from dark gray to magenta
-    if (squareValue <= CHANNEL_VALUE_MIN) {
-        squareColor = TFT_DARKGREY;
-    } else if (squareValue >= CHANNEL_VALUE_MAX) {
-        squareColor = TFT_MAGENTA;
-    } else {
-        // Linear interpolation
-        uint8_t intensity = map(squareValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        // Extract and interpolate RGB components
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_MAGENTA >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_MAGENTA >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_MAGENTA & 0x1F);
-        squareColor = (r << 11) | (g << 5) | b;
-    }
-    
-    // For Cross (Channel 8) - interpolate from dark gray to blue
-    if (crossValue <= CHANNEL_VALUE_MIN) {
-        crossColor = TFT_DARKGREY;
-    } else if (crossValue >= CHANNEL_VALUE_MAX) {
-        crossColor = TFT_BLUE;
-    } else {
-        uint8_t intensity = map(crossValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_BLUE >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_BLUE >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_BLUE & 0x1F);
-        crossColor = (r << 11) | (g << 5) | b;
-    }
-    
-    // For Circle (Channel 9) - interpolate from dark gray to red
-    if (circleValue <= CHANNEL_VALUE_MIN) {
-        circleColor = TFT_DARKGREY;
-    } else if (circleValue >= CHANNEL_VALUE_MAX) {
-        circleColor = TFT_RED;
-    } else {
-        uint8_t intensity = map(circleValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_RED >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_RED >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_RED & 0x1F);
-        circleColor = (r << 11) | (g << 5) | b;
-    }
-    
-    // For Triangle (Channel 11) - interpolate from dark gray to green
-    if (triangleValue <= CHANNEL_VALUE_MIN) {
-        triangleColor = TFT_DARKGREY;
-    } else if (triangleValue >= CHANNEL_VALUE_MAX) {
-        triangleColor = TFT_GREEN;
-    } else {
-        uint8_t intensity = map(triangleValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_GREEN >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_GREEN >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_GREEN & 0x1F);
-        triangleColor = (r << 11) | (g << 5) | b;
+void ControllerScreen::handleButton(uint8_t button) {
+    // Save a flight recording on demand
+    if (button == UI_BUTTON_NEXT && recorder != nullptr) {
+        recorder->trigger(TRIGGER_MANUAL);
     }
-    
-    // Draw PS5-like button layout (circle pattern)
-    // Triangle (top)
-    M5.Lcd.fillCircle(centerX, centerY - BUTTON_SPACING, BUTTON_RADIUS, triangleColor);
-    
-    // Circle (right)
-    M5.Lcd.fillCircle(centerX + BUTTON_SPACING, centerY, BUTTON_RADIUS, circleColor);
-    
-    // Cross (bottom)
-    M5.Lcd.fillCircle(centerX, centerY + BUTTON_SPACING, BUTTON_RADIUS, crossColor);
-    
-    // Square (left)
-    M5.Lcd.fillCircle(centerX - BUTTON_SPACING, centerY, BUTTON_RADIUS, squareColor);
-    
-    // Button symbols
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextDatum(MC_DATUM);
-    
-    // Draw triangle symbol
-    M5.Lcd.setTextColor(triangleValue > CHANNEL_VALUE_MID ? TFT_BLACK : TFT_WHITE);
-    M5.Lcd.drawString("^", centerX, centerY - BUTTON_SPACING);
-    
-    // Draw circle symbol
-    M5.Lcd.setTextColor(circleValue > CHANNEL_VALUE_MID ? TFT_BLACK : TFT_WHITE);
-    M5.Lcd.drawString("O", centerX + BUTTON_SPACING, centerY);
-    
-    // Draw cross symbol
-    M5.Lcd.setTextColor(crossValue > CHANNEL_VALUE_MID ? TFT_BLACK : TFT_WHITE);
-    M5.Lcd.drawString("X", centerX, centerY + BUTTON_SPACING);
-    
-    // Draw square symbol
-    M5.Lcd.setTextColor(squareValue > CHANNEL_VALUE_MID ? TFT_BLACK : TFT_WHITE);
-    M5.Lcd.drawString("□", centerX - BUTTON_SPACING, centerY);
 }
 
-void ControllerScreen::drawDPad(int centerX, int centerY) {
-    // D-pad dimensions
-    const int DPAD_SIZE = 15;
-    const int DPAD_CROSS_SIZE = 10;
-    
-    // Get D-pad values from channelManager instead of controller
-    uint16_t upValue = channelManager->getChannel(12);     // Channel 12: Up
-    uint16_t downValue = channelManager->getChannel(13);   // Channel 13: Down
-    uint16_t leftValue = channelManager->getChannel(14);   // Channel 14: Left
-    uint16_t rightValue = channelManager->getChannel(15);  // Channel 15: Right
-    
-    // Calculate colors based on channel values
-    uint16_t upColor, downColor, leftColor, rightColor;
-    
-    // Calculate color interpolation for UP button
-    if (upValue <= CHANNEL_VALUE_MIN) {
-        upColor = TFT_DARKGREY;
-    } else if (upValue >= CHANNEL_VALUE_MAX) {
-        upColor = TFT_WHITE;
-    } else {
-        uint8_t intensity = map(upValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_WHITE >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_WHITE >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_WHITE & 0x1F);
-        upColor = (r << 11) | (g << 5) | b;
-    }
-    
-    // Calculate color interpolation for DOWN button
-    if (downValue <= CHANNEL_VALUE_MIN) {
-        downColor = TFT_DARKGREY;
-    } else if (downValue >= CHANNEL_VALUE_MAX) {
-        downColor = TFT_WHITE;
-    } else {
-        uint8_t intensity = map(downValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_WHITE >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_WHITE >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_WHITE & 0x1F);
-        downColor = (r << 11) | (g << 5) | b;
-    }
-    
-    // Calculate color interpolation for LEFT button
-    if (leftValue <= CHANNEL_VALUE_MIN) {
-        leftColor = TFT_DARKGREY;
-    } else if (leftValue >= CHANNEL_VALUE_MAX) {
-        leftColor = TFT_WHITE;
-    } else {
-        uint8_t intensity = map(leftValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_WHITE >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_WHITE >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_WHITE & 0x1F);
-        leftColor = (r << 11) | (g << 5) | b;
+void ControllerScreen::endFrame(unsigned long startTime) {
+    // Each dirty rectangle is clipped out of the sprite and sent as one DMA
+    // transfer. endWrite() waits for them, which keeps the sprite safe to draw
+    // into next frame.
+    if (canvasReady && dirtyRegion.getCount() > 0) {
+        const lgfx::swap565_t* buffer = (const lgfx::swap565_t*)canvas.getBuffer();
+        
+        M5.Lcd.startWrite();
+        for (int i = 0; i < dirtyRegion.getCount(); i++) {
+            const Rect& rect = dirtyRegion.getRect(i);
+            M5.Lcd.setClipRect(rect.x, rect.y, rect.w, rect.h);
+            M5.Lcd.pushImageDMA(0, 0, canvas.width(), canvas.height(), buffer);
+        }
+        M5.Lcd.clearClipRect();
+        M5.Lcd.endWrite();
     }
     
-    // Calculate color interpolation for RIGHT button
-    if (rightValue <= CHANNEL_VALUE_MIN) {
-        rightColor = TFT_DARKGREY;
-    } else if (rightValue >= CHANNEL_VALUE_MAX) {
-        rightColor = TFT_WHITE;
-    } else {
-        uint8_t intensity = map(rightValue, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255);
-        uint8_t r = map(intensity, 0, 255, (TFT_DARKGREY >> 11) & 0x1F, (TFT_WHITE >> 11) & 0x1F);
-        uint8_t g = map(intensity, 0, 255, (TFT_DARKGREY >> 5) & 0x3F, (TFT_WHITE >> 5) & 0x3F);
-        uint8_t b = map(intensity, 0, 255, TFT_DARKGREY & 0x1F, TFT_WHITE & 0x1F);
-        rightColor = (r << 11) | (g << 5) | b;
+    // Pixel data only; direct drawing sends the same widget areas, in many
+    // smaller transactions
+    uint32_t frameBytes = dirtyRegion.getArea() * 2;
+    uint32_t elapsed = micros() - startTime;
+    stats.frames++;
+    stats.busyUs += elapsed;
+    stats.maxUs = max(stats.maxUs, elapsed);
+    stats.bytes += frameBytes;
+    
+    // Periodic benchmark line to compare the sprite and direct paths
+    unsigned long now = millis();
+    if (now - stats.since >= RENDER_STATS_INTERVAL_MS && stats.frames > 0) {
+        LOG_I(LOG_DISPLAY, canvasReady ? "sprite: %u frames, avg %u us, max %u us, %u bytes/frame"
+                                       : "direct: %u frames, avg %u us, max %u us, %u bytes/frame",
+              stats.frames, stats.busyUs / stats.frames, stats.maxUs, stats.bytes / stats.frames);
+        memset(&stats, 0, sizeof(stats));
+        stats.since = now;
     }
-    
-    // Draw D-pad cross base
-    M5.Lcd.fillRect(centerX - DPAD_CROSS_SIZE/2, centerY - DPAD_SIZE, DPAD_CROSS_SIZE, DPAD_SIZE * 2, TFT_DARKGREY);
-    M5.Lcd.fillRect(centerX - DPAD_SIZE, centerY - DPAD_CROSS_SIZE/2, DPAD_SIZE * 2, DPAD_CROSS_SIZE, TFT_DARKGREY);
-    
-    // Highlight active directions with interpolated colors
-    // Up direction
-    M5.Lcd.fillRect(centerX - DPAD_CROSS_SIZE/2, centerY - DPAD_SIZE, DPAD_CROSS_SIZE, DPAD_SIZE, upColor);
-    
-    // Down direction
-    M5.Lcd.fillRect(centerX - DPAD_CROSS_SIZE/2, centerY, DPAD_CROSS_SIZE, DPAD_SIZE, downColor);
-    
-    // Left direction
-    M5.Lcd.fillRect(centerX - DPAD_SIZE, centerY - DPAD_CROSS_SIZE/2, DPAD_SIZE, DPAD_CROSS_SIZE, leftColor);
-    
-    // Right direction
-    M5.Lcd.fillRect(centerX, centerY - DPAD_CROSS_SIZE/2, DPAD_SIZE, DPAD_CROSS_SIZE, rightColor);
-} 
\ No newline at end of file
+}
@@ -21,34 +21,51 @@
  */
 
 
+
 #pragma once
 
 #include "Screen.h"
-#include "../controllers/Controller.h"
-#include "../controllers/PS5Controller.h"
-#include "../channels/ChannelManager.h"
+#include "../recorder/FlightRecorder.h"
 
 class ControllerScreen : public Screen {
 public:
-    ControllerScreen(Controller* controller, ChannelManager* channelManager);
+    // Button B saves a flight recording
+    ControllerScreen(FlightRecorder* recorder);
     ~ControllerScreen() override = default;
     
     void activate() override;
     void deactivate() override;
-    void update() override;
+    void update(const UiSnapshot& snapshot) override;
     void handleButton(uint8_t button) override;
     
 private:
-    void drawStick(int x, int y, int valueX, int valueY, int prevX, int prevY, uint16_t color);
-    void drawTrigger(int x, int y, int l2Value, int r2Value, int prevL2, int prevR2, uint16_t color);
-    void drawButtons(int centerX, int centerY);
-    void drawDPad(int centerX, int centerY);
-    void drawShoulderButtons(int centerX, int centerY);
+    // Per-update timing and SPI traffic, logged every RENDER_STATS_INTERVAL_MS
+    struct RenderStats {
+        uint32_t frames;
+        uint32_t busyUs;
+        uint32_t maxUs;
+        uint32_t bytes;
+        unsigned long since;
+    };
+    
+    // Push the dirty rectangles of the sprite and update the stats
+    void endFrame(unsigned long startTime);
+    
+    FlightRecorder* recorder;
+    
+    // Static labels
+    LabelWidget title, l1Label, r1Label, l2Label, r2Label;
     
-    Controller* controller;
-    ChannelManager* channelManager;
+    // Live inputs
+    StickWidget leftStick, rightStick;
+    ButtonDotWidget l1, r1;
+    BarWidget l2, r2;
+    DPadWidget dpad;
+    ButtonDotWidget triangle, circle, cross, square;
+    ButtonDotWidget link;
     
-    // Previous state tracking to reduce screen updates
-    int prevLX, prevLY, prevRX, prevRY;
-    int prevL2, prevR2;
-}; 
\ No newline at end of file
+    // Off-screen frame, dirty areas are pushed to the panel once per update
+    M5Canvas canvas;
+    bool canvasReady;
+    RenderStats stats;
+};
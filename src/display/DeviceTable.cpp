@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "DeviceTable.h"
+
+static_assert((DEVICE_TABLE_HASH_SIZE & (DEVICE_TABLE_HASH_SIZE - 1)) == 0, "DEVICE_TABLE_HASH_SIZE must be a power of two");
+static_assert(DEVICE_TABLE_HASH_SIZE > DEVICE_TABLE_SIZE, "DEVICE_TABLE_HASH_SIZE must leave empty buckets");
+static_assert(DEVICE_TABLE_SIZE < 255, "Entry indices are stored in a byte");
+
+// Known DualSense address prefixes
+const DeviceTable::OuiPrefix DeviceTable::ps5Prefixes[] = {
+    {0x481800, 0xFFFF00},  // 48:18
+    {0x3C0100, 0xFFFF00},  // 3C:01
+    {0x58FA00, 0xFFFF00},  // 58:FA
+    {0x289900, 0xFFFF00},  // 28:99
+    {0x401C00, 0xFFFF00},  // 40:1C
+};
+
+// Score parts, in order of importance
+static const uint16_t SCORE_SAVED = 0x4000;
+static const uint16_t SCORE_PS5_OUI = 0x2000;
+static const uint16_t SCORE_PS5_NAME = 0x1000;
+
+DeviceTable::DeviceTable() {
+    clear();
+}
+
+void DeviceTable::clear() {
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+}
+
+uint64_t DeviceTable::packMac(const uint8_t address[6]) {
+    uint64_t mac = 0;
+    for (int i = 0; i < 6; i++) {
+        mac = (mac << 8) | address[i];
+    }
+    return mac;
+}
+
+uint32_t DeviceTable::hashMac(uint64_t mac) {
+    // Fold to 32 bits, then multiplicative hash; the low bytes vary most
+    uint32_t folded = (uint32_t)mac ^ (uint32_t)(mac >> 32);
+    return (folded * 2654435761u) >> 16;
+}
+
+bool DeviceTable::matchesPS5Oui(uint64_t mac) {
+    uint32_t oui = (uint32_t)(mac >> 24);
+    for (const OuiPrefix& prefix : ps5Prefixes) {
+        if ((oui & prefix.mask) == prefix.value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DeviceTable::matchesPS5Name(const char* name) {
+    return strstr(name, "DualSense") != nullptr ||
+           strstr(name, "Wireless Controller") != nullptr ||
+           strstr(name, "Sony") != nullptr;
+}
+
+int DeviceTable::findBucket(uint64_t mac) const {
+    int bucket = hashMac(mac) & (DEVICE_TABLE_HASH_SIZE - 1);
+    while (buckets[bucket] != 0 && entries[buckets[bucket] - 1].mac != mac) {
+        bucket = (bucket + 1) & (DEVICE_TABLE_HASH_SIZE - 1);
+    }
+    return bucket;
+}
+
+void DeviceTable::rank(uint8_t index) {
+    DeviceEntry& entry = entries[index];
+    
+    bool ouiMatch = matchesPS5Oui(entry.mac);
+    bool nameMatch = entry.hasName && matchesPS5Name(entry.name);
+    entry.isLikelyPS5 = ouiMatch || nameMatch;
+    entry.isConfirmedPS5 = ouiMatch && nameMatch;
+    entry.score = (entry.isSaved ? SCORE_SAVED : 0) +
+                  (ouiMatch ? SCORE_PS5_OUI : 0) +
+                  (nameMatch ? SCORE_PS5_NAME : 0) +
+                  (uint8_t)(entry.rssi + 128);
+    
+    // Equal scores keep discovery order
+    int position = count - 1;
+    while (position > 0 && entries[order[position - 1]].score < entry.score) {
+        order[position] = order[position - 1];
+        position--;
+    }
+    order[position] = index;
+}
+
+void DeviceTable::unrank(uint8_t index) {
+    int position = 0;
+    while (order[position] != index) {
+        position++;
+    }
+    memmove(&order[position], &order[position + 1], count - 1 - position);
+    order[count - 1] = index;
+}
+
+DeviceEntry* DeviceTable::add(const uint8_t address[6], const char* name, int8_t rssi, bool isSaved, bool& changed) {
+    uint64_t mac = packMac(address);
+    int bucket = findBucket(mac);
+    bool hasName = name != nullptr && name[0] != '\0';
+    changed = false;
+    
+    if (buckets[bucket] != 0) {
+        // Known device: keep its place unless it just told us its name
+        DeviceEntry& entry = entries[buckets[bucket] - 1];
+        if (rssi != DISCOVERY_RSSI_UNKNOWN) {
+            entry.rssi = rssi;
+        }
+        if (hasName && !entry.hasName) {
+            snprintf(entry.name, sizeof(entry.name), "%s", name);
+            entry.hasName = true;
+            unrank(buckets[bucket] - 1);
+            rank(buckets[bucket] - 1);
+            changed = true;
+        }
+        return &entry;
+    }
+    
+    if (count >= DEVICE_TABLE_SIZE) {
+        return nullptr;
+    }
+    
+    uint8_t index = count++;
+    DeviceEntry& entry = entries[index];
+    entry.mac = mac;
+    snprintf(entry.address, sizeof(entry.address), "%02x:%02x:%02x:%02x:%02x:%02x",
+             address[0], address[1], address[2], address[3], address[4], address[5]);
+    snprintf(entry.name, sizeof(entry.name), "%s", hasName ? name : "Unknown Device");
+    entry.hasName = hasName;
+    entry.rssi = rssi;
+    entry.isSaved = isSaved;
+    buckets[bucket] = index + 1;
+    rank(index);
+    
+    changed = true;
+    return &entry;
+}
+
+bool DeviceTable::remove(uint64_t mac) {
+    int bucket = findBucket(mac);
+    if (buckets[bucket] == 0) {
+        return false;
+    }
+    
+    // Drop it from the index, then move the last entry into its slot
+    uint8_t removed = buckets[bucket] - 1;
+    unrank(removed);
+    count--;
+    if (removed != count) {
+        entries[removed] = entries[count];
+        for (int i = 0; i < count; i++) {
+            if (order[i] == count) {
+                order[i] = removed;
+            }
+        }
+    }
+    
+    // Linear probing cannot empty a single bucket; rebuild (rare, user action)
+    memset(buckets, 0, sizeof(buckets));
+    for (int i = 0; i < count; i++) {
+        buckets[findBucket(entries[i].mac)] = i + 1;
+    }
+    return true;
+}
+
+const DeviceEntry* DeviceTable::find(uint64_t mac) const {
+    int bucket = findBucket(mac);
+    return buckets[bucket] != 0 ? &entries[buckets[bucket] - 1] : nullptr;
+}
+
+int DeviceTable::size() const {
+    return count;
+}
+
+DeviceEntry& DeviceTable::get(int rank) {
+    return entries[order[rank]];
+}
+
+const DeviceEntry& DeviceTable::get(int rank) const {
+    return entries[order[rank]];
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include "../Config.h"
+
+// One device in the Bluetooth menu
+struct DeviceEntry {
+    uint64_t mac;                    // 48-bit address, first byte in the top bits
+    char address[18];                // "xx:xx:xx:xx:xx:xx"
+    char name[DISCOVERY_NAME_SIZE];
+    int8_t rssi;                     // DISCOVERY_RSSI_UNKNOWN when not reported
+    bool isSaved;                    // The controller stored in preferences
+    bool isLikelyPS5;                // OUI or name matched
+    bool isConfirmedPS5;             // OUI and name matched
+    bool hasName;                    // False until a result carried a name
+    uint16_t score;                  // Menu order, highest first
+    
+    // List rows, formatted by the screen when the entry is added or renamed
+    char nameRow[WIDGET_LABEL_SIZE];
+    char addressRow[WIDGET_LABEL_SIZE];
+};
+
+// Fixed-capacity device table with no heap use. Entries are found by MAC
+// through an open-addressed hash and listed through an index kept sorted by
+// a score computed once per entry: saved device, PS5 OUI, PS5 name, RSSI.
+class DeviceTable {
+public:
+    DeviceTable();
+    
+    // Remove every entry
+    void clear();
+    
+    // Insert a device or refresh the one with the same MAC. Returns the entry,
+    // nullptr when the table is full; changed is set when its rows need formatting.
+    DeviceEntry* add(const uint8_t address[6], const char* name, int8_t rssi, bool isSaved, bool& changed);
+    
+    // Remove the device with this MAC, false if it is not in the table
+    bool remove(uint64_t mac);
+    
+    // Entry with this MAC, nullptr if it is not in the table
+    const DeviceEntry* find(uint64_t mac) const;
+    
+    // Entries in menu order
+    int size() const;
+    DeviceEntry& get(int rank);
+    const DeviceEntry& get(int rank) const;
+
+private:
+    // A PS5 controller OUI; value and mask cover the top 24 bits of the MAC
+    struct OuiPrefix {
+        uint32_t value;
+        uint32_t mask;
+    };
+    
+    static const OuiPrefix ps5Prefixes[];
+    
+    static uint64_t packMac(const uint8_t address[6]);
+    static uint32_t hashMac(uint64_t mac);
+    static bool matchesPS5Oui(uint64_t mac);
+    static bool matchesPS5Name(const char* name);
+    
+    // Bucket holding mac, or the empty bucket it would go in
+    int findBucket(uint64_t mac) const;
+    
+    // Score an entry and place it in the sorted index
+    void rank(uint8_t index);
+    void unrank(uint8_t index);
+    
+    DeviceEntry entries[DEVICE_TABLE_SIZE];
+    uint8_t buckets[DEVICE_TABLE_HASH_SIZE];  // Entry index + 1, 0 = empty
+    uint8_t order[DEVICE_TABLE_SIZE];         // Entry indices, highest score first
+    int count;
+};
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "../Config.h"
+
+// One Bluetooth discovery result, copied out of the stack's callback
+struct DiscoveryRecord {
+    uint8_t address[6];
+    char name[DISCOVERY_NAME_SIZE];  // Truncated, always terminated
+    int8_t rssi;                     // DISCOVERY_RSSI_UNKNOWN when not reported
+};
+
+// Single-producer single-consumer ring. The Bluetooth task pushes, the UI
+// task pops; neither side allocates, locks or waits.
+class DiscoveryQueue {
+public:
+    DiscoveryQueue() : head(0), tail(0), dropped(0) {}
+    
+    // Called from the Bluetooth task only; a full queue drops the record
+    bool push(const DiscoveryRecord& record) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= DISCOVERY_QUEUE_SIZE) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[h & (DISCOVERY_QUEUE_SIZE - 1)] = record;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Called from the UI task only; false when empty
+    bool pop(DiscoveryRecord& out) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = slots[t & (DISCOVERY_QUEUE_SIZE - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // Records lost to a full queue since boot
+    uint32_t getDropped() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    static_assert((DISCOVERY_QUEUE_SIZE & (DISCOVERY_QUEUE_SIZE - 1)) == 0, "DISCOVERY_QUEUE_SIZE must be a power of two");
+    
+    DiscoveryRecord slots[DISCOVERY_QUEUE_SIZE];
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;
+    std::atomic<uint32_t> dropped;
+};
@@ -22,8 +22,22 @@
 
 
 #include "LogoScreen.h"
+#include "../utils/Log.h"
+#include "../utils/BootTimeline.h"
 #include <M5StickCPlus2.h>
+
+#if LOGO_PNG
 #include "../logo.h"
+#define LOGO_WIDTH 135
+#define LOGO_HEIGHT 135
+#else
+#include "../logo_rle.h"
+#define LOGO_WIDTH LOGO_RLE_WIDTH
+#define LOGO_HEIGHT LOGO_RLE_HEIGHT
+
+// Decoded lines on their way to the panel; the only buffer the logo needs
+static uint16_t chunkBuffer[LOGO_RLE_WIDTH * LOGO_CHUNK_LINES];
+#endif
 
 LogoScreen::LogoScreen() : 
     Screen(),
@@ -41,7 +55,7 @@ void LogoScreen::deactivate() {
     // Nothing specific needed when deactivating
 }
 
-void LogoScreen::update() {
+void LogoScreen::update(const UiSnapshot& snapshot) {
     if (redrawNeeded) {
         M5.Lcd.clear();
         
@@ -49,18 +63,17 @@ void LogoScreen::update() {
             // Set background color
             M5.Lcd.fillScreen(TFT_BLACK);
             
-            // Draw image from embedded data
-            M5.Lcd.startWrite();
-            
             // Calculate center position
-            int x = (M5.Lcd.width() - 135) / 2;  // Adjust based on actual image width
-            int y = (M5.Lcd.height() - 135) / 2;  // Adjust based on actual image height
+            int x = (M5.Lcd.width() - LOGO_WIDTH) / 2;
+            int y = (M5.Lcd.height() - LOGO_HEIGHT) / 2;
             
-            // Draw the PNG directly from memory
-            M5.Lcd.drawPng(logo_logo_png, logo_logo_png_len, x, y);
-            
-            M5.Lcd.endWrite();
-            Serial.println("Logo displayed from memory");
+            // Draw time and the heap low-water mark, to compare the two paths
+            unsigned long start = micros();
+            uint32_t minHeapBefore = ESP.getMinFreeHeap();
+            drawLogo(x, y);
+            LOG_I(LOG_DISPLAY, "Logo drawn in %lu us, heap low-water %u -> %u",
+                  micros() - start, minHeapBefore, ESP.getMinFreeHeap());
+            BootTimeline::mark(BOOT_LOGO_DRAWN);
             
             hasShownLogo = true;
         }
@@ -69,6 +82,53 @@ void LogoScreen::update() {
     }
 }
 
+#if LOGO_PNG
+void LogoScreen::drawLogo(int x, int y) {
+    // Draw the PNG directly from memory (decoder and its buffers on the heap)
+    M5.Lcd.startWrite();
+    M5.Lcd.drawPng(logo_logo_png, logo_logo_png_len, x, y);
+    M5.Lcd.endWrite();
+}
+#else
+void LogoScreen::drawLogo(int x, int y) {
+    // Expand the runs (format in tools/logo/png2rle.py) a few lines at a
+    // time; a run may carry over into the next chunk
+    const uint16_t* src = logo_rle;
+    const uint16_t* end = logo_rle + logo_rle_len;
+    uint16_t count = 0;
+    bool repeat = false;
+    uint16_t value = 0;
+    
+    M5.Lcd.startWrite();
+    for (int row = 0; row < LOGO_RLE_HEIGHT; row += LOGO_CHUNK_LINES) {
+        int lines = min(LOGO_CHUNK_LINES, LOGO_RLE_HEIGHT - row);
+        int pixels = lines * LOGO_RLE_WIDTH;
+        
+        for (int i = 0; i < pixels; i++) {
+            if (count == 0) {
+                // Truncated data ends in black instead of reading past the array
+                if (src >= end) {
+                    memset(&chunkBuffer[i], 0, (pixels - i) * sizeof(chunkBuffer[0]));
+                    break;
+                }
+                uint16_t header = *src++;
+                repeat = (header & 0x8000) != 0;
+                count = header & 0x7FFF;
+                if (repeat) {
+                    value = (src < end) ? *src++ : 0;
+                }
+            }
+            chunkBuffer[i] = repeat ? value : (src < end ? *src++ : 0);
+            count--;
+        }
+        
+        // Pixels are stored in panel byte order
+        M5.Lcd.pushImage(x, y + row, LOGO_RLE_WIDTH, lines, (const lgfx::swap565_t*)chunkBuffer);
+    }
+    M5.Lcd.endWrite();
+}
+#endif
+
 void LogoScreen::handleButton(uint8_t button) {
     // No button handling in logo screen
 } 
\ No newline at end of file
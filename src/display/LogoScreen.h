@@ -31,10 +31,13 @@ public:
     
     void activate() override;
     void deactivate() override;
-    void update() override;
+    void update(const UiSnapshot& snapshot) override;
     void handleButton(uint8_t button) override;
     
 private:
+    // Put the logo on the panel with its top left corner at x, y
+    void drawLogo(int x, int y);
+    
     unsigned long activationTime;
     bool hasShownLogo;
 }; 
\ No newline at end of file
@@ -23,7 +23,11 @@
 
 #include "Screen.h"
 
-Screen::Screen() : redrawNeeded(true) {
+Screen::Screen() :
+    redrawNeeded(true),
+    dialog(4, 20, M5.Lcd.width() - 8, 12),
+    dialogOpen(false),
+    dialogUntil(0) {
 }
 
 bool Screen::needsRedraw() const {
@@ -32,4 +36,54 @@ bool Screen::needsRedraw() const {
 
 void Screen::setNeedsRedraw() {
     redrawNeeded = true;
-} 
\ No newline at end of file
+}
+
+DialogWidget& Screen::openDialog(unsigned long timeoutMs) {
+    dialog.clear();
+    dialogOpen = true;
+    dialogUntil = millis() + timeoutMs;
+    setNeedsRedraw();
+    return dialog;
+}
+
+bool Screen::dismissDialog() {
+    if (!dialogOpen) {
+        return false;
+    }
+    dialogOpen = false;
+    setNeedsRedraw();
+    return true;
+}
+
+void Screen::addWidget(Widget* widget) {
+    widgets.push_back(widget);
+}
+
+void Screen::renderWidgets(LovyanGFX& gfx) {
+    // An expired dialog closes by itself
+    if (dialogOpen && (long)(millis() - dialogUntil) >= 0) {
+        dismissDialog();
+    }
+    
+    dirtyRegion.clear();
+    
+    if (redrawNeeded) {
+        gfx.fillScreen(TFT_BLACK);
+        dirtyRegion.add(0, 0, gfx.width(), gfx.height());
+        for (auto widget : widgets) {
+            widget->invalidate();
+        }
+        dialog.invalidate();
+        redrawNeeded = false;
+    }
+    
+    // The widgets keep taking updates underneath and repaint when it closes
+    if (dialogOpen) {
+        dialog.render(gfx, dirtyRegion);
+        return;
+    }
+    
+    for (auto widget : widgets) {
+        widget->render(gfx, dirtyRegion);
+    }
+}
\ No newline at end of file
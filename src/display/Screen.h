@@ -24,6 +24,16 @@
 #pragma once
 
 #include <M5StickCPlus2.h>
+#include <vector>
+#include "Widgets.h"
+#include "UiSnapshot.h"
+
+// Button events routed to the active screen
+enum UiButton {
+    UI_BUTTON_SELECT = 0,    // BtnA short press
+    UI_BUTTON_NEXT = 1,      // BtnB short press
+    UI_BUTTON_PREVIOUS = 2   // BtnB long press
+};
 
 // Abstract base class for all screens
 class Screen {
@@ -37,8 +47,8 @@ public:
     // Called when screen becomes inactive
     virtual void deactivate() = 0;
     
-    // Update screen content
-    virtual void update() = 0;
+    // Update screen content from the latest published state (render task)
+    virtual void update(const UiSnapshot& snapshot) = 0;
     
     // Process button input
     virtual void handleButton(uint8_t button) = 0;
@@ -49,6 +59,30 @@ public:
     // Mark screen as needing redraw
     void setNeedsRedraw();
     
+    // Close the open dialog; true when there was one, so the button press
+    // that closed it goes no further
+    bool dismissDialog();
+    
 protected:
+    // Show a dialog over the screen until timeoutMs passes or a button is
+    // pressed, without blocking; fill in the returned widget's lines
+    DialogWidget& openDialog(unsigned long timeoutMs);
+    
+
+    // Register a widget drawn by renderWidgets()
+    void addWidget(Widget* widget);
+    
+    // Draw changed widgets (all of them after setNeedsRedraw) and collect
+    // the painted areas in dirtyRegion
+    void renderWidgets(LovyanGFX& gfx);
+    
     bool redrawNeeded;
+    
+    // Modal dialog, drawn instead of the widgets while open
+    DialogWidget dialog;
+    bool dialogOpen;
+    unsigned long dialogUntil;
+    
+    std::vector<Widget*> widgets;
+    DirtyRegion dirtyRegion;
 }; 
\ No newline at end of file
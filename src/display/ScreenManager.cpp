@@ -21,11 +21,26 @@
  */
 
 
+
 #include "ScreenManager.h"
+#include "../utils/Log.h"
 
 ScreenManager::ScreenManager() : 
     currentScreenType(SCREEN_STATUS),
-    currentScreen(nullptr) {
+    currentScreen(nullptr),
+    commandQueue(nullptr),
+    renderTaskHandle(nullptr),
+    renderedFrames(0),
+    droppedFrames(0),
+    droppedCommands(0),
+    displayLevel(DISPLAY_ACTIVE),
+    fullBrightness(0),
+    swallowedButtons(0),
+    publishedGeneration(0),
+    publishedConnected(false) {
+    
+    memset(levelBusyUs, 0, sizeof(levelBusyUs));
+    memset(levelTimeMs, 0, sizeof(levelTimeMs));
 }
 
 ScreenManager::~ScreenManager() {
@@ -47,21 +62,160 @@ void ScreenManager::registerScreen(ScreenType type, Screen* screen) {
     
     // If this is the first screen, make it active
     if (currentScreen == nullptr) {
-        currentScreen = screen;
-        currentScreenType = type;
-        currentScreen->activate();
+        applyScreen(type);
+    }
+}
+
+bool ScreenManager::begin() {
+    if (renderTaskHandle != nullptr) {
+        return true;
+    }
+    
+    commandQueue = xQueueCreate(UI_COMMAND_QUEUE_LENGTH, sizeof(UiCommand));
+    if (commandQueue == nullptr) {
+        return false;
+    }
+    
+    // Core 0 at priority 1: below the Bluetooth stack, never competing with the loop on core 1
+    BaseType_t created = xTaskCreatePinnedToCore(renderTaskEntry, "ui", 6144, this, 1, &renderTaskHandle, 0);
+    if (created != pdPASS) {
+        LOG_E(LOG_DISPLAY, "Failed to start render task");
+        renderTaskHandle = nullptr;
+        return false;
     }
+    
+    // Button events are taken by the render task
+    DeviceButtons::setListener(renderTaskHandle);
+    return true;
 }
 
 void ScreenManager::switchToScreen(ScreenType type) {
     // Check if screen exists
     if (type >= screens.size() || screens[type] == nullptr) {
-        Serial.println("Screen not available");
+        LOG_W(LOG_DISPLAY, "Screen not available");
+        return;
+    }
+    
+    // The render task may be about to cycle away from the screen shown now,
+    // so always queue the switch; applyScreen() skips one that changes nothing
+    sendCommand(UiCommand::SWITCH_SCREEN, type);
+}
+
+ScreenType ScreenManager::getCurrentScreenType() const {
+    return currentScreenType;
+}
+
+void ScreenManager::publish(const UiSnapshot& snapshot) {
+    snapshotBuffer.publish(snapshot);
+    
+    // A status change wakes a dimmed or blank display without waiting a frame
+    if (snapshot.statusGeneration != publishedGeneration || snapshot.connected != publishedConnected) {
+        publishedGeneration = snapshot.statusGeneration;
+        publishedConnected = snapshot.connected;
+        if (renderTaskHandle != nullptr) {
+            xTaskNotifyGive(renderTaskHandle);
+        }
+    }
+}
+
+void ScreenManager::handleButton(uint8_t button) {
+    sendCommand(UiCommand::BUTTON, button);
+}
+
+void ScreenManager::handleButton(const ButtonEvent& event) {
+    if (currentScreen == nullptr) {
+        return;
+    }
+    
+    // Presses and releases only matter through the gestures they make up
+    if (event.type == BUTTON_EVENT_PRESS || event.type == BUTTON_EVENT_RELEASE) {
         return;
     }
     
-    // Skip if already on this screen
-    if (type == currentScreenType) {
+    // A press on an open dialog only closes it
+    if (event.type != BUTTON_EVENT_REPEAT && currentScreen->dismissDialog()) {
+        return;
+    }
+    
+    if (event.button == DEVICE_BUTTON_A) {
+        if (event.type == BUTTON_EVENT_LONG) {
+            cycleScreen();
+        } else if (event.type == BUTTON_EVENT_SHORT) {
+            currentScreen->handleButton(UI_BUTTON_SELECT);
+        }
+    } else if (event.type == BUTTON_EVENT_SHORT) {
+        currentScreen->handleButton(UI_BUTTON_NEXT);
+    } else {
+        // Long press and repeats while held step backwards
+        currentScreen->handleButton(UI_BUTTON_PREVIOUS);
+    }
+}
+
+uint32_t ScreenManager::getRenderedFrames() const {
+    return renderedFrames;
+}
+
+uint32_t ScreenManager::getDroppedFrames() const {
+    return droppedFrames;
+}
+
+void ScreenManager::sendCommand(UiCommand::Type type, uint8_t value) {
+    UiCommand command = { type, value };
+    
+    // Before begin() everything runs on the setup task
+    if (commandQueue == nullptr) {
+        if (type == UiCommand::SWITCH_SCREEN) {
+            applyScreen((ScreenType)value);
+        } else if (currentScreen != nullptr && !currentScreen->dismissDialog()) {
+            currentScreen->handleButton(value);
+        }
+        return;
+    }
+    
+    if (xQueueSend(commandQueue, &command, 0) != pdTRUE) {
+        droppedCommands++;
+    } else if (renderTaskHandle != nullptr) {
+        xTaskNotifyGive(renderTaskHandle);
+    }
+}
+
+bool ScreenManager::processCommands() {
+    UiCommand command;
+    bool any = false;
+    
+    while (xQueueReceive(commandQueue, &command, 0) == pdTRUE) {
+        any = true;
+        if (command.type == UiCommand::SWITCH_SCREEN) {
+            applyScreen((ScreenType)command.value);
+        } else if (currentScreen != nullptr && !currentScreen->dismissDialog()) {
+            // A press on an open dialog only closes it
+            currentScreen->handleButton(command.value);
+        }
+    }
+    
+    ButtonEvent event;
+    while (DeviceButtons::poll(event)) {
+        any = true;
+        
+        // A press on a blank display only wakes it
+        uint8_t mask = 1 << event.button;
+        if (displayLevel == DISPLAY_BLANK && event.type == BUTTON_EVENT_PRESS) {
+            swallowedButtons |= mask;
+        }
+        if (swallowedButtons & mask) {
+            if (event.type == BUTTON_EVENT_RELEASE) {
+                swallowedButtons &= ~mask;
+            }
+            continue;
+        }
+        handleButton(event);
+    }
+    return any;
+}
+
+void ScreenManager::applyScreen(ScreenType type) {
+    Screen* screen = screens[type];
+    if (screen == currentScreen) {
         return;
     }
     
@@ -70,9 +224,10 @@ void ScreenManager::switchToScreen(ScreenType type) {
         currentScreen->deactivate();
     }
     
-    // Switch to new screen
+    // Switch to new screen; the only place the type is written, so it always
+    // names the screen that is actually shown
+    currentScreen = screen;
     currentScreenType = type;
-    currentScreen = screens[type];
     
     // Activate new screen
     if (currentScreen != nullptr) {
@@ -80,18 +235,176 @@ void ScreenManager::switchToScreen(ScreenType type) {
     }
 }
 
-ScreenType ScreenManager::getCurrentScreenType() const {
-    return currentScreenType;
+void ScreenManager::cycleScreen() {
+    static const ScreenType cycle[] = { SCREEN_STATUS, SCREEN_CONTROLLER, SCREEN_CONNECTION };
+    const int count = sizeof(cycle) / sizeof(cycle[0]);
+    
+    // The logo (or any screen outside the cycle) leaves to the first one
+    int index = count - 1;
+    for (int i = 0; i < count; i++) {
+        if (cycle[i] == currentScreenType) {
+            index = i;
+        }
+    }
+    
+    // Skip screens this build does not have, such as the connection screen
+    // of the BLE gamepad build
+    for (int step = 1; step <= count; step++) {
+        ScreenType next = cycle[(index + step) % count];
+        if (next < screens.size() && screens[next] != nullptr) {
+            applyScreen(next);
+            return;
+        }
+    }
 }
 
-void ScreenManager::update() {
-    if (currentScreen != nullptr) {
-        currentScreen->update();
+DisplayLevel ScreenManager::governorLevel(unsigned long sinceAttention) const {
+    if (sinceAttention >= DISPLAY_BLANK_AFTER_MS) {
+        return DISPLAY_BLANK;
+    }
+    if (sinceAttention >= DISPLAY_DIM_AFTER_MS) {
+        return DISPLAY_DIMMED;
+    }
+    if (sinceAttention >= DISPLAY_REDUCED_AFTER_MS) {
+        return DISPLAY_REDUCED;
     }
+    return DISPLAY_ACTIVE;
 }
 
-void ScreenManager::handleButton(uint8_t button) {
-    if (currentScreen != nullptr) {
-        currentScreen->handleButton(button);
+void ScreenManager::setDisplayLevel(DisplayLevel level) {
+    switch (level) {
+        case DISPLAY_ACTIVE:
+        case DISPLAY_REDUCED:
+            M5.Lcd.setBrightness(fullBrightness);
+            break;
+        case DISPLAY_DIMMED:
+            M5.Lcd.setBrightness(min(fullBrightness, (uint8_t)DISPLAY_DIM_BRIGHTNESS));
+            break;
+        default:
+            M5.Lcd.setBrightness(0);
+            break;
     }
-} 
\ No newline at end of file
+    LOG_D(LOG_DISPLAY, "Display level %d -> %d", displayLevel, level);
+    displayLevel = level;
+}
+
+void ScreenManager::logDisplayStats(unsigned long intervalMs, uint64_t intervalBusyUs) {
+    static const char* const levelNames[DISPLAY_LEVEL_COUNT] = { "active", "reduced", "dimmed", "blank" };
+    
+    // Render time per second at full rate, and what the lower levels did not spend of it
+    uint64_t activeRate = levelTimeMs[DISPLAY_ACTIVE] > 0 ?
+        levelBusyUs[DISPLAY_ACTIVE] * 1000 / levelTimeMs[DISPLAY_ACTIVE] : 0;
+    uint64_t savedUs = 0;
+    for (int level = DISPLAY_REDUCED; level < DISPLAY_LEVEL_COUNT; level++) {
+        uint64_t wouldSpend = activeRate * levelTimeMs[level] / 1000;
+        if (wouldSpend > levelBusyUs[level]) {
+            savedUs += wouldSpend - levelBusyUs[level];
+        }
+    }
+    
+    LOG_I(LOG_DISPLAY, "display %s: render %lu us/s, %lu us/s when active, %lu ms saved",
+          levelNames[displayLevel],
+          (unsigned long)(intervalMs > 0 ? intervalBusyUs * 1000 / intervalMs : 0),
+          (unsigned long)activeRate, (unsigned long)(savedUs / 1000));
+}
+
+void ScreenManager::renderTaskEntry(void* param) {
+    static_cast<ScreenManager*>(param)->renderLoop();
+}
+
+void ScreenManager::renderLoop() {
+    UiSnapshot snapshot;
+    UiSnapshot lastSnapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    memset(&lastSnapshot, 0, sizeof(lastSnapshot));
+    
+    unsigned long lastChange = millis();
+    unsigned long lastAttention = millis();
+    unsigned long lastStats = millis();
+    unsigned long lastAccount = millis();
+    uint64_t intervalBusyUs = 0;
+    TickType_t lastWake = xTaskGetTickCount();
+    
+    // Whatever M5.begin() set is the full level
+    fullBrightness = M5.Lcd.getBrightness();
+    
+    while (true) {
+        bool hadCommands = processCommands();
+        snapshotBuffer.read(snapshot);
+        unsigned long now = millis();
+        
+        // Buttons, screen switches and status changes mean someone is looking;
+        // stick movement does not. Without a controller, and on the logo and
+        // connection screens, the display stays up
+        ScreenType type = currentScreenType;
+        if (hadCommands || !snapshot.connected ||
+            snapshot.connected != lastSnapshot.connected ||
+            snapshot.statusGeneration != lastSnapshot.statusGeneration ||
+            (type != SCREEN_STATUS && type != SCREEN_CONTROLLER)) {
+            lastAttention = now;
+        }
+        
+        // Drop to the idle frame rate once nothing has changed for a while
+        if (hadCommands || !snapshot.sameContent(lastSnapshot)) {
+            lastSnapshot = snapshot;
+            lastChange = now;
+        }
+        bool idle = now - lastChange >= UI_IDLE_AFTER_MS;
+        
+        levelTimeMs[displayLevel] += now - lastAccount;
+        lastAccount = now;
+        DisplayLevel level = governorLevel(now - lastAttention);
+        
+        // Render time includes the SPI transfers, which screens wait for
+        if (currentScreen != nullptr && level != DISPLAY_BLANK) {
+            uint32_t start = micros();
+            currentScreen->update(snapshot);
+            uint32_t busy = micros() - start;
+            levelBusyUs[displayLevel] += busy;
+            intervalBusyUs += busy;
+            renderedFrames++;
+        }
+        
+        // After the frame, so a display coming back lights up with current content
+        if (level != displayLevel) {
+            setDisplayLevel(level);
+        }
+        
+        if (now - lastStats >= RENDER_STATS_INTERVAL_MS) {
+            LOG_D(LOG_DISPLAY, "ui: %u rendered, %u dropped, %u commands dropped",
+                  renderedFrames, droppedFrames, droppedCommands);
+            logDisplayStats(now - lastStats, intervalBusyUs);
+            intervalBusyUs = 0;
+            lastStats = now;
+        }
+        
+        // Blank: nothing to draw until a button, a command or a status change
+        if (displayLevel == DISPLAY_BLANK) {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RENDER_STATS_INTERVAL_MS));
+            lastWake = xTaskGetTickCount();
+            continue;
+        }
+        
+        uint32_t frameRate = idle ? UI_IDLE_FRAME_RATE : UI_FRAME_RATE;
+        if (displayLevel == DISPLAY_REDUCED) {
+            frameRate = min(frameRate, (uint32_t)UI_REDUCED_FRAME_RATE);
+        } else if (displayLevel == DISPLAY_DIMMED) {
+            frameRate = UI_IDLE_FRAME_RATE;
+        }
+        
+        // A frame that overran skips the slots it used up instead of
+        // rendering back to back to catch up
+        TickType_t period = pdMS_TO_TICKS(1000 / frameRate);
+        TickType_t elapsed = xTaskGetTickCount() - lastWake;
+        if (elapsed >= period) {
+            droppedFrames += elapsed / period;
+            lastWake = xTaskGetTickCount();
+            vTaskDelay(1);
+        } else if (ulTaskNotifyTake(pdTRUE, period - elapsed) > 0) {
+            // A command or button event: handle it now, pace from here
+            lastWake = xTaskGetTickCount();
+        } else {
+            lastWake += period;
+        }
+    }
+}
@@ -26,6 +26,7 @@
 #include <Arduino.h>
 #include <vector>
 #include "Screen.h"
+#include "../utils/DeviceButtons.h"
 
 // Screen types
 enum ScreenType {
@@ -38,6 +39,35 @@ enum ScreenType {
     SCREEN_SETTINGS = 5
 };
 
+// Steps of the display idle governor, brightest first
+enum DisplayLevel : uint8_t {
+    DISPLAY_ACTIVE = 0,     // Full brightness and frame rate
+    DISPLAY_REDUCED,        // Frame rate capped at UI_REDUCED_FRAME_RATE
+    DISPLAY_DIMMED,         // Backlight dimmed, UI_IDLE_FRAME_RATE
+    DISPLAY_BLANK,          // Backlight off, no screen updates at all
+    DISPLAY_LEVEL_COUNT
+};
+
+// Requests from other tasks, carried out by the render task
+struct UiCommand {
+    enum Type : uint8_t {
+        SWITCH_SCREEN,
+        BUTTON
+    };
+    Type type;
+    uint8_t value;  // ScreenType or UiButton
+};
+
+// Owns the screens and runs them on a low-priority render task. The main loop
+// only publishes a UiSnapshot and queues commands, neither of which can block,
+// so slow redraws never delay controller polling or CRSF output. Commands and
+// button events wake the task, they do not wait for the next frame slot.
+//
+// While a controller is connected and nobody presses a button, an idle
+// governor steps the display down: a lower frame rate, a dimmed backlight,
+// and finally a blank panel with Screen::update() suspended. Stick movement
+// does not count as attention, so this happens in flight. A button press, a
+// screen switch or a status change (a disconnect) brings it back at once.
 class ScreenManager {
 public:
     ScreenManager();
@@ -46,20 +76,69 @@ public:
     // Register a screen
     void registerScreen(ScreenType type, Screen* screen);
     
-    // Switch to a screen
+    // Start the render task; screens are only touched from that task afterwards
+    bool begin();
+    
+    // Switch to a screen (any task)
     void switchToScreen(ScreenType type);
     
-    // Get current screen type
+    // Screen shown now; a switch still in the queue is not reflected yet
     ScreenType getCurrentScreenType() const;
     
-    // Update current screen
-    void update();
+    // Publish the state to render next (main loop only)
+    void publish(const UiSnapshot& snapshot);
     
-    // Handle button input
+    // Route a button to the current screen (any task)
     void handleButton(uint8_t button);
     
+    // Act on a press of the device's own buttons (render task): a long press
+    // on A cycles the screens, the rest reach the screen as a UiButton
+    void handleButton(const ButtonEvent& event);
+    
+    // Frames drawn, and frame slots skipped because a frame overran its budget
+    uint32_t getRenderedFrames() const;
+    uint32_t getDroppedFrames() const;
+    
 private:
+    static void renderTaskEntry(void* param);
+    void renderLoop();
+    
+    // Queue a command, or apply it directly before the task is running
+    void sendCommand(UiCommand::Type type, uint8_t value);
+    
+    // Apply queued commands, returns true if there were any
+    bool processCommands();
+    void applyScreen(ScreenType type);
+    
+    // Next screen in the manual cycle (status, controller, connection)
+    void cycleScreen();
+    
+    // Idle governor: the level for the time without attention, applying a
+    // level, and the render time it saved
+    DisplayLevel governorLevel(unsigned long sinceAttention) const;
+    void setDisplayLevel(DisplayLevel level);
+    void logDisplayStats(unsigned long intervalMs, uint64_t intervalBusyUs);
+    
     std::vector<Screen*> screens;
-    ScreenType currentScreenType;
+    volatile ScreenType currentScreenType;
     Screen* currentScreen;
-}; 
\ No newline at end of file
+    
+    UiSnapshotBuffer snapshotBuffer;
+    QueueHandle_t commandQueue;
+    TaskHandle_t renderTaskHandle;
+    
+    volatile uint32_t renderedFrames;
+    volatile uint32_t droppedFrames;
+    volatile uint32_t droppedCommands;
+    
+    // Idle governor (render task)
+    DisplayLevel displayLevel;
+    uint8_t fullBrightness;
+    uint8_t swallowedButtons;       // Woke a blank display, ignored until released
+    uint64_t levelBusyUs[DISPLAY_LEVEL_COUNT];
+    uint64_t levelTimeMs[DISPLAY_LEVEL_COUNT];
+    
+    // Status last published; a change wakes the render task (main loop only)
+    uint32_t publishedGeneration;
+    bool publishedConnected;
+};
\ No newline at end of file
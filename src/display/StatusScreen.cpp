@@ -23,10 +23,24 @@
 
 #include "StatusScreen.h"
 
-StatusScreen::StatusScreen(Controller* controller) : 
+StatusScreen::StatusScreen(FlightRecorder* recorder) : 
     Screen(),
-    controller(controller),
-    statusMessage("WAITING") {
+    recorder(recorder),
+    shownGeneration(UINT32_MAX),
+    shownRate(UINT16_MAX),
+    shownGaps(UINT32_MAX),
+    title(0, 20, M5.Lcd.width(), 20, MC_DATUM, 2, TFT_WHITE),
+    status(0, 70, M5.Lcd.width(), 20, MC_DATUM, 2, TFT_WHITE),
+    reports(0, 110, M5.Lcd.width(), 10, MC_DATUM, 1, TFT_LIGHTGREY),
+    link(ButtonDotWidget::SHAPE_CIRCLE, M5.Lcd.width() / 2 - 5, M5.Lcd.height() - 20, 11, 11, TFT_RED, TFT_GREEN) {
+    
+    title.setText("Status");
+    status.setText("WAITING");
+    
+    addWidget(&title);
+    addWidget(&status);
+    addWidget(&reports);
+    addWidget(&link);
 }
 
 void StatusScreen::activate() {
@@ -37,37 +51,31 @@ void StatusScreen::deactivate() {
     // Nothing specific needed when deactivating
 }
 
-void StatusScreen::update() {
-    String currentStatus = controller->getStatusMessage();
+void StatusScreen::update(const UiSnapshot& snapshot) {
+    // Status text is only looked up when the status generation moved
+    if (snapshot.statusGeneration != shownGeneration) {
+        status.setText(getStatusText(snapshot.status));
+        shownGeneration = snapshot.statusGeneration;
+    }
     
-    // Only redraw if status changed or redraw is needed
-    if (currentStatus != statusMessage || redrawNeeded) {
-        statusMessage = currentStatus;
-        
-        // Clear the screen
-        M5.Lcd.clear();
-        
-        // Title
-        M5.Lcd.setTextColor(TFT_WHITE);
-        M5.Lcd.setTextSize(2);
-        M5.Lcd.setCursor(0, 30);
-        M5.Lcd.setTextDatum(MC_DATUM);
-        M5.Lcd.drawString("Status", M5.Lcd.width() / 2, 30);
-        
-        // Status
-        M5.Lcd.drawString(statusMessage, M5.Lcd.width() / 2, 80);
-        
-        // Connection indicator
-        if (controller->isConnected()) {
-            M5.Lcd.fillCircle(M5.Lcd.width() / 2, M5.Lcd.height() - 15, 5, TFT_GREEN);
-        } else {
-            M5.Lcd.drawCircle(M5.Lcd.width() / 2, M5.Lcd.height() - 15, 5, TFT_RED);
-        }
-        
-        redrawNeeded = false;
+    // Input report rate over the last second and gaps since the link came
+    // up, formatted only when they change
+    if (snapshot.reportRate != shownRate || snapshot.reportGaps != shownGaps) {
+        char text[WIDGET_LABEL_SIZE];
+        snprintf(text, sizeof(text), "%u Hz  %lu gaps/link", snapshot.reportRate, (unsigned long)snapshot.reportGaps);
+        reports.setText(text);
+        shownRate = snapshot.reportRate;
+        shownGaps = snapshot.reportGaps;
     }
+    
+    // Widgets only repaint when the status or connection state changed
+    link.setValue(snapshot.connected ? CHANNEL_VALUE_MAX : CHANNEL_VALUE_MIN);
+    renderWidgets(M5.Lcd);
 }
 
 void StatusScreen::handleButton(uint8_t button) {
-    // No button handling in status screen
-} 
\ No newline at end of file
+    // Save a flight recording on demand
+    if (button == UI_BUTTON_NEXT && recorder != nullptr) {
+        recorder->trigger(TRIGGER_MANUAL);
+    }
+}
\ No newline at end of file
@@ -24,19 +24,31 @@
 #pragma once
 
 #include "Screen.h"
-#include "../controllers/Controller.h"
+#include "../recorder/FlightRecorder.h"
 
 class StatusScreen : public Screen {
 public:
-    StatusScreen(Controller* controller);
+    // Button B saves a flight recording
+    StatusScreen(FlightRecorder* recorder);
     ~StatusScreen() override = default;
     
     void activate() override;
     void deactivate() override;
-    void update() override;
+    void update(const UiSnapshot& snapshot) override;
     void handleButton(uint8_t button) override;
     
 private:
-    Controller* controller;
-    String statusMessage;
+    FlightRecorder* recorder;
+    
+    // Status generation currently shown
+    uint32_t shownGeneration;
+    
+    // Report meter values currently shown
+    uint16_t shownRate;
+    uint32_t shownGaps;
+    
+    LabelWidget title;
+    LabelWidget status;
+    LabelWidget reports;
+    ButtonDotWidget link;
 }; 
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "../channels/ChannelManager.h"
+#include "../controllers/Controller.h"
+
+// State the screens render from, published by the main loop
+struct UiSnapshot {
+    uint16_t channels[NUM_CHANNELS];
+    bool connected;
+    ControllerStatus status;
+    uint32_t statusGeneration;  // Changes whenever status does
+    uint16_t reportRate;        // Input reports in the last second
+    uint32_t reportGaps;        // Input gaps over REPORT_GAP_THRESHOLD_MS since the link came up
+    
+    // Same inputs and status as another snapshot
+    bool sameContent(const UiSnapshot& other) const {
+        return connected == other.connected &&
+               statusGeneration == other.statusGeneration &&
+               reportRate == other.reportRate &&
+               reportGaps == other.reportGaps &&
+               memcmp(channels, other.channels, sizeof(channels)) == 0;
+    }
+};
+
+// Single-writer seqlock. The writer never waits; a reader that overlaps a
+// publish sees an odd or changed sequence and copies again.
+class UiSnapshotBuffer {
+public:
+    UiSnapshotBuffer() : sequence(0) {
+        memset(&data, 0, sizeof(data));
+    }
+    
+    // Called from the main loop only
+    void publish(const UiSnapshot& snapshot) {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&data, &snapshot, sizeof(data));
+        std::atomic_thread_fence(std::memory_order_release);
+        sequence.store(seq + 2, std::memory_order_relaxed);
+    }
+    
+    // Copy the latest snapshot, false until the first publish
+    bool read(UiSnapshot& out) const {
+        while (true) {
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before == 0) {
+                return false;
+            }
+            if (before & 1) {
+                continue;
+            }
+            memcpy(&out, &data, sizeof(out));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                return true;
+            }
+        }
+    }
+
+private:
+    std::atomic<uint32_t> sequence;
+    UiSnapshot data;
+};
@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Widgets.h"
+
+DirtyRegion::DirtyRegion() : count(0) {
+}
+
+void DirtyRegion::add(int x, int y, int w, int h) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    
+    // Join an overlapping or touching rectangle, or the one that grows least when full
+    int target = -1;
+    uint32_t leastGrowth = UINT32_MAX;
+    for (int i = 0; i < count; i++) {
+        const Rect& r = rects[i];
+        if (x <= r.x + r.w && r.x <= x + w && y <= r.y + r.h && r.y <= y + h) {
+            target = i;
+            break;
+        }
+        
+        if (count == SCREEN_MAX_DIRTY_RECTS) {
+            uint32_t width = max(x + w, r.x + r.w) - min(x, (int)r.x);
+            uint32_t height = max(y + h, r.y + r.h) - min(y, (int)r.y);
+            uint32_t growth = width * height - (uint32_t)r.w * r.h;
+            if (growth < leastGrowth) {
+                leastGrowth = growth;
+                target = i;
+            }
+        }
+    }
+    
+    if (target < 0) {
+        rects[count].x = x;
+        rects[count].y = y;
+        rects[count].w = w;
+        rects[count].h = h;
+        count++;
+        return;
+    }
+    
+    Rect& r = rects[target];
+    int left = min(x, (int)r.x);
+    int top = min(y, (int)r.y);
+    r.w = max(x + w, r.x + r.w) - left;
+    r.h = max(y + h, r.y + r.h) - top;
+    r.x = left;
+    r.y = top;
+}
+
+void DirtyRegion::clear() {
+    count = 0;
+}
+
+int DirtyRegion::getCount() const {
+    return count;
+}
+
+const Rect& DirtyRegion::getRect(int index) const {
+    return rects[index];
+}
+
+uint32_t DirtyRegion::getArea() const {
+    uint32_t area = 0;
+    for (int i = 0; i < count; i++) {
+        area += (uint32_t)rects[i].w * rects[i].h;
+    }
+    return area;
+}
+
+uint16_t blendColor565(uint16_t from, uint16_t to, uint8_t amount) {
+    // Interpolate each RGB565 component separately
+    uint8_t r = map(amount, 0, 255, (from >> 11) & 0x1F, (to >> 11) & 0x1F);
+    uint8_t g = map(amount, 0, 255, (from >> 5) & 0x3F, (to >> 5) & 0x3F);
+    uint8_t b = map(amount, 0, 255, from & 0x1F, to & 0x1F);
+    return (r << 11) | (g << 5) | b;
+}
+
+uint16_t channelColor(uint16_t value, uint16_t offColor, uint16_t onColor) {
+    if (value <= CHANNEL_VALUE_MIN) {
+        return offColor;
+    }
+    if (value >= CHANNEL_VALUE_MAX) {
+        return onColor;
+    }
+    return blendColor565(offColor, onColor, map(value, CHANNEL_VALUE_MIN, CHANNEL_VALUE_MAX, 0, 255));
+}
+
+Widget::Widget(int x, int y, int w, int h) : dirty(true) {
+    bounds.x = x;
+    bounds.y = y;
+    bounds.w = w;
+    bounds.h = h;
+}
+
+void Widget::render(LovyanGFX& gfx, DirtyRegion& region) {
+    if (!dirty) {
+        return;
+    }
+    draw(gfx);
+    region.add(bounds.x, bounds.y, bounds.w, bounds.h);
+    dirty = false;
+}
+
+void Widget::invalidate() {
+    dirty = true;
+}
+
+bool Widget::isDirty() const {
+    return dirty;
+}
+
+const Rect& Widget::getBounds() const {
+    return bounds;
+}
+
+// Marker radius, the marker may stick out of the ring by this much
+static const int STICK_MARKER_RADIUS = 5;
+
+StickWidget::StickWidget(int centerX, int centerY, int radius, uint16_t color) :
+    Widget(centerX - radius - STICK_MARKER_RADIUS, centerY - radius - STICK_MARKER_RADIUS,
+           (radius + STICK_MARKER_RADIUS) * 2 + 1, (radius + STICK_MARKER_RADIUS) * 2 + 1),
+    radius(radius),
+    color(color),
+    posX(0), posY(0) {
+}
+
+void StickWidget::setValue(int valueX, int valueY) {
+    // Map PS5 stick values (-128 to 127) to the ring, Y axis inverted
+    int8_t x = map(valueX, -128, 127, -radius, radius);
+    int8_t y = map(valueY, -128, 127, radius, -radius);
+    if (x != posX || y != posY) {
+        posX = x;
+        posY = y;
+        dirty = true;
+    }
+}
+
+void StickWidget::draw(LovyanGFX& gfx) {
+    int cx = bounds.x + bounds.w / 2;
+    int cy = bounds.y + bounds.h / 2;
+    
+    gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_BLACK);
+    gfx.drawCircle(cx, cy, radius, TFT_DARKGREY);
+    gfx.fillCircle(cx + posX, cy + posY, STICK_MARKER_RADIUS, color);
+    gfx.drawFastHLine(cx - radius, cy, radius * 2, TFT_DARKGREY);
+    gfx.drawFastVLine(cx, cy - radius, radius * 2, TFT_DARKGREY);
+}
+
+BarWidget::BarWidget(int x, int y, int w, int h, uint16_t color) :
+    Widget(x, y, w, h),
+    color(color),
+    fillWidth(0) {
+}
+
+void BarWidget::setValue(int value) {
+    int16_t width = map(value, 0, 255, 0, bounds.w);
+    if (width != fillWidth) {
+        fillWidth = width;
+        dirty = true;
+    }
+}
+
+void BarWidget::draw(LovyanGFX& gfx) {
+    gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_BLACK);
+    gfx.drawRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_DARKGREY);
+    if (fillWidth > 0) {
+        gfx.fillRect(bounds.x, bounds.y, fillWidth, bounds.h, color);
+    }
+}
+
+ButtonDotWidget::ButtonDotWidget(Shape shape, int x, int y, int w, int h, uint16_t offColor, uint16_t onColor, const char* symbol) :
+    Widget(x, y, w, h),
+    shape(shape),
+    offColor(offColor),
+    onColor(onColor),
+    symbol(symbol),
+    color(offColor),
+    highlighted(false) {
+}
+
+void ButtonDotWidget::setValue(uint16_t value) {
+    uint16_t newColor = channelColor(value, offColor, onColor);
+    bool newHighlighted = value > CHANNEL_VALUE_MID;
+    if (newColor != color || newHighlighted != highlighted) {
+        color = newColor;
+        highlighted = newHighlighted;
+        dirty = true;
+    }
+}
+
+void ButtonDotWidget::draw(LovyanGFX& gfx) {
+    int cx = bounds.x + bounds.w / 2;
+    int cy = bounds.y + bounds.h / 2;
+    
+    if (shape == SHAPE_CIRCLE) {
+        gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_BLACK);
+        gfx.fillCircle(cx, cy, min(bounds.w, bounds.h) / 2, color);
+    } else {
+        gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, color);
+        gfx.drawRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_DARKGREY);
+    }
+    
+    if (symbol != nullptr) {
+        gfx.setTextSize(1);
+        gfx.setTextDatum(MC_DATUM);
+        gfx.setTextColor(highlighted ? TFT_BLACK : TFT_WHITE);
+        gfx.drawString(symbol, cx, cy);
+    }
+}
+
+DPadWidget::DPadWidget(int centerX, int centerY, int size, int crossSize, uint16_t onColor) :
+    Widget(centerX - size, centerY - size, size * 2, size * 2),
+    size(size),
+    crossSize(crossSize),
+    onColor(onColor) {
+    for (int i = 0; i < 4; i++) {
+        colors[i] = TFT_DARKGREY;
+    }
+}
+
+void DPadWidget::setValue(uint16_t up, uint16_t down, uint16_t left, uint16_t right) {
+    uint16_t newColors[4] = {
+        channelColor(up, TFT_DARKGREY, onColor),
+        channelColor(down, TFT_DARKGREY, onColor),
+        channelColor(left, TFT_DARKGREY, onColor),
+        channelColor(right, TFT_DARKGREY, onColor)
+    };
+    if (memcmp(newColors, colors, sizeof(colors)) != 0) {
+        memcpy(colors, newColors, sizeof(colors));
+        dirty = true;
+    }
+}
+
+void DPadWidget::draw(LovyanGFX& gfx) {
+    int cx = bounds.x + size;
+    int cy = bounds.y + size;
+    
+    // The four arms cover the whole cross
+    gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_BLACK);
+    gfx.fillRect(cx - crossSize/2, cy - size, crossSize, size, colors[0]);
+    gfx.fillRect(cx - crossSize/2, cy, crossSize, size, colors[1]);
+    gfx.fillRect(cx - size, cy - crossSize/2, size, crossSize, colors[2]);
+    gfx.fillRect(cx, cy - crossSize/2, size, crossSize, colors[3]);
+}
+
+LabelWidget::LabelWidget(int x, int y, int w, int h, uint8_t datum, uint8_t textSize, uint16_t color) :
+    Widget(x, y, w, h),
+    datum(datum),
+    textSize(textSize),
+    color(color) {
+    text[0] = '\0';
+}
+
+void LabelWidget::setText(const char* newText) {
+    if (strncmp(text, newText, sizeof(text) - 1) != 0) {
+        strncpy(text, newText, sizeof(text) - 1);
+        text[sizeof(text) - 1] = '\0';
+        dirty = true;
+    }
+}
+
+void LabelWidget::setColor(uint16_t newColor) {
+    if (newColor != color) {
+        color = newColor;
+        dirty = true;
+    }
+}
+
+void LabelWidget::draw(LovyanGFX& gfx) {
+    // Anchor inside the bounds according to the datum (left/center/right, top/middle/bottom)
+    int horizontal = datum & 3;
+    int vertical = datum & 12;
+    int x = bounds.x + (horizontal == 1 ? bounds.w / 2 : horizontal == 2 ? bounds.w - 1 : 0);
+    int y = bounds.y + (vertical == 4 ? bounds.h / 2 : vertical == 8 ? bounds.h - 1 : 0);
+    
+    gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_BLACK);
+    gfx.setTextSize(textSize);
+    gfx.setTextDatum(datum);
+    gfx.setTextColor(color);
+    gfx.drawString(text, x, y);
+}
+
+ListWidget::ListWidget(int x, int y, int w, int rowHeight, int rows) :
+    Widget(x, y, w, rowHeight * min(rows, WIDGET_LIST_MAX_ROWS)),
+    rowHeight(rowHeight),
+    rowCount(min(rows, WIDGET_LIST_MAX_ROWS)) {
+    for (int i = 0; i < rowCount; i++) {
+        this->rows[i].text[0] = '\0';
+        this->rows[i].color = TFT_WHITE;
+        this->rows[i].background = TFT_BLACK;
+        this->rows[i].dirty = true;
+    }
+}
+
+void ListWidget::setRow(int row, const char* text, uint16_t color, uint16_t background) {
+    if (row < 0 || row >= rowCount) {
+        return;
+    }
+    
+    Row& entry = rows[row];
+    if (entry.color != color || entry.background != background || strncmp(entry.text, text, sizeof(entry.text) - 1) != 0) {
+        strncpy(entry.text, text, sizeof(entry.text) - 1);
+        entry.text[sizeof(entry.text) - 1] = '\0';
+        entry.color = color;
+        entry.background = background;
+        entry.dirty = true;
+        dirty = true;
+    }
+}
+
+void ListWidget::invalidate() {
+    for (int i = 0; i < rowCount; i++) {
+        rows[i].dirty = true;
+    }
+    dirty = true;
+}
+
+int ListWidget::getRowCount() const {
+    return rowCount;
+}
+
+void ListWidget::render(LovyanGFX& gfx, DirtyRegion& region) {
+    if (!dirty) {
+        return;
+    }
+    
+    // A full invalidate repaints every row, otherwise only the changed ones
+    for (int i = 0; i < rowCount; i++) {
+        if (rows[i].dirty) {
+            drawRow(gfx, i);
+            region.add(bounds.x, bounds.y + i * rowHeight, bounds.w, rowHeight);
+        }
+    }
+    dirty = false;
+}
+
+void ListWidget::draw(LovyanGFX& gfx) {
+    for (int i = 0; i < rowCount; i++) {
+        drawRow(gfx, i);
+    }
+}
+
+void ListWidget::drawRow(LovyanGFX& gfx, int row) {
+    Row& entry = rows[row];
+    int y = bounds.y + row * rowHeight;
+    
+    gfx.fillRect(bounds.x, y, bounds.w, rowHeight, entry.background);
+    gfx.setTextSize(1);
+    gfx.setTextDatum(ML_DATUM);
+    gfx.setTextColor(entry.color);
+    gfx.drawString(entry.text, bounds.x + 2, y + rowHeight / 2);
+    entry.dirty = false;
+}
+
+DialogWidget::DialogWidget(int x, int y, int w, int lineHeight) :
+    Widget(x, y, w, lineHeight * DIALOG_MAX_LINES + 8),
+    lineHeight(lineHeight),
+    lineCount(0) {
+}
+
+void DialogWidget::clear() {
+    lineCount = 0;
+    dirty = true;
+}
+
+void DialogWidget::addLine(const char* text, uint16_t color) {
+    if (lineCount >= DIALOG_MAX_LINES) {
+        return;
+    }
+    strncpy(lines[lineCount].text, text, sizeof(lines[lineCount].text) - 1);
+    lines[lineCount].text[sizeof(lines[lineCount].text) - 1] = '\0';
+    lines[lineCount].color = color;
+    lineCount++;
+    dirty = true;
+}
+
+void DialogWidget::draw(LovyanGFX& gfx) {
+    gfx.fillRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_BLACK);
+    gfx.drawRect(bounds.x, bounds.y, bounds.w, bounds.h, TFT_DARKGREY);
+    gfx.setTextSize(1);
+    gfx.setTextDatum(ML_DATUM);
+    for (int i = 0; i < lineCount; i++) {
+        gfx.setTextColor(lines[i].color);
+        gfx.drawString(lines[i].text, bounds.x + 4, bounds.y + 4 + i * lineHeight + lineHeight / 2);
+    }
+}
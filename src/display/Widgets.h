@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#pragma once
+
+#include <M5StickCPlus2.h>
+#include "../Config.h"
+
+// Screen rectangle
+struct Rect {
+    int16_t x, y, w, h;
+};
+
+// Up to SCREEN_MAX_DIRTY_RECTS changed areas for one frame. Overlapping
+// areas are merged; when full, the new area joins the rectangle it grows least.
+class DirtyRegion {
+public:
+    DirtyRegion();
+    
+    void add(int x, int y, int w, int h);
+    void clear();
+    
+    int getCount() const;
+    const Rect& getRect(int index) const;
+    
+    // Total pixels covered by the rectangles
+    uint32_t getArea() const;
+
+private:
+    Rect rects[SCREEN_MAX_DIRTY_RECTS];
+    int count;
+};
+
+// Blend two RGB565 colors, amount 0 gives from and 255 gives to
+uint16_t blendColor565(uint16_t from, uint16_t to, uint8_t amount);
+
+// Color for a channel value, from offColor at MIN to onColor at MAX
+uint16_t channelColor(uint16_t value, uint16_t offColor, uint16_t onColor);
+
+// Retained-mode widget: caches the value it last drew and only paints its
+// own bounds when that value changes
+class Widget {
+public:
+    Widget(int x, int y, int w, int h);
+    virtual ~Widget() = default;
+    
+    // Draw if changed and add the painted area to the region
+    virtual void render(LovyanGFX& gfx, DirtyRegion& region);
+    
+    // Force a redraw on the next render
+    virtual void invalidate();
+    
+    bool isDirty() const;
+    const Rect& getBounds() const;
+
+protected:
+    // Paint the full bounds, background included
+    virtual void draw(LovyanGFX& gfx) = 0;
+    
+    Rect bounds;
+    bool dirty;
+};
+
+// Analog stick: ring, crosshair and a position marker
+class StickWidget : public Widget {
+public:
+    StickWidget(int centerX, int centerY, int radius, uint16_t color);
+    
+    // Stick position, -128 to 127 on both axes
+    void setValue(int valueX, int valueY);
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    int radius;
+    uint16_t color;
+    int8_t posX, posY;  // Marker offset in pixels
+};
+
+// Horizontal fill bar with a border
+class BarWidget : public Widget {
+public:
+    BarWidget(int x, int y, int w, int h, uint16_t color);
+    
+    // Fill level, 0 to 255
+    void setValue(int value);
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    uint16_t color;
+    int16_t fillWidth;
+};
+
+// Button shown as a circle or box whose color follows its channel value
+class ButtonDotWidget : public Widget {
+public:
+    enum Shape {
+        SHAPE_CIRCLE,
+        SHAPE_BOX
+    };
+    
+    ButtonDotWidget(Shape shape, int x, int y, int w, int h, uint16_t offColor, uint16_t onColor, const char* symbol = nullptr);
+    
+    // Channel value, CHANNEL_VALUE_MIN to CHANNEL_VALUE_MAX
+    void setValue(uint16_t value);
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    Shape shape;
+    uint16_t offColor, onColor;
+    const char* symbol;
+    uint16_t color;
+    bool highlighted;  // Symbol drawn dark on a bright button
+};
+
+// D-pad cross with one color per direction
+class DPadWidget : public Widget {
+public:
+    DPadWidget(int centerX, int centerY, int size, int crossSize, uint16_t onColor);
+    
+    // Channel values for each direction
+    void setValue(uint16_t up, uint16_t down, uint16_t left, uint16_t right);
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    int size, crossSize;
+    uint16_t onColor;
+    uint16_t colors[4];  // Up, down, left, right
+};
+
+// Single line of text, copied so callers may pass temporaries
+class LabelWidget : public Widget {
+public:
+    LabelWidget(int x, int y, int w, int h, uint8_t datum, uint8_t textSize, uint16_t color);
+    
+    void setText(const char* text);
+    void setColor(uint16_t color);
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    uint8_t datum;
+    uint8_t textSize;
+    uint16_t color;
+    char text[WIDGET_LABEL_SIZE];
+};
+
+// Fixed rows of text; only rows whose text or colors changed are repainted
+class ListWidget : public Widget {
+public:
+    ListWidget(int x, int y, int w, int rowHeight, int rows);
+    
+    void setRow(int row, const char* text, uint16_t color, uint16_t background = TFT_BLACK);
+    int getRowCount() const;
+    
+    void render(LovyanGFX& gfx, DirtyRegion& region) override;
+    void invalidate() override;
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    struct Row {
+        char text[WIDGET_LABEL_SIZE];
+        uint16_t color;
+        uint16_t background;
+        bool dirty;
+    };
+    
+    void drawRow(LovyanGFX& gfx, int row);
+    
+    int rowHeight;
+    int rowCount;
+    Row rows[WIDGET_LIST_MAX_ROWS];
+};
+
+// Bordered message box with lines of text, shown modally by Screen::openDialog()
+class DialogWidget : public Widget {
+public:
+    DialogWidget(int x, int y, int w, int lineHeight);
+    
+    // Remove all lines
+    void clear();
+    
+    // Append a line, ignored once DIALOG_MAX_LINES are used
+    void addLine(const char* text, uint16_t color);
+
+protected:
+    void draw(LovyanGFX& gfx) override;
+
+private:
+    struct Line {
+        char text[WIDGET_LABEL_SIZE];
+        uint16_t color;
+    };
+    
+    int lineHeight;
+    int lineCount;
+    Line lines[DIALOG_MAX_LINES];
+};
@@ -0,0 +1,571 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Generated by tools/logo/png2rle.py from logo.h, do not edit.
+// 135x135, 12854 bytes (the PNG is 26274 bytes); format in png2rle.py.
+
+#pragma once
+
+#include <stdint.h>
+
+#define LOGO_RLE_WIDTH 135
+#define LOGO_RLE_HEIGHT 135
+
+static const uint16_t logo_rle[] = {
+  0x81d4, 0x0000, 0x000d, 0x0100, 0x2310, 0x2208, 0x0000, 0x2208, 0x2308, 0x2310, 0x4720, 0x4720,
+  0x6820, 0x4618, 0x4518, 0x0100, 0x8021, 0x0000, 0x0001, 0x0208, 0x8053, 0x0000, 0x0017, 0x0108,
+  0x2308, 0x6820, 0x8c38, 0xaf48, 0xf460, 0xf668, 0xb048, 0xb050, 0xf568, 0xf568, 0xf560, 0xf560,
+  0x1669, 0x1771, 0x1669, 0xd250, 0xb048, 0xd150, 0xaf48, 0xaf48, 0x6928, 0x0208, 0x806d, 0x0000,
+  0x0005, 0x2208, 0x4410, 0x4720, 0xb050, 0xf668, 0x8005, 0x1871, 0x0003, 0xf258, 0xae40, 0x8b38,
+  0x8003, 0x6a30, 0x000f, 0xad38, 0xd048, 0xd258, 0xf568, 0x1879, 0x3a79, 0x1a79, 0x3a79, 0x3979,
+  0xf568, 0xb050, 0x6928, 0x2410, 0x0000, 0x0100, 0x8065, 0x0000, 0x0022, 0x0100, 0x6928, 0xd358,
+  0xd358, 0xf768, 0x1879, 0x1979, 0xf668, 0xd048, 0xaf48, 0xd460, 0xf770, 0x1871, 0xd150, 0xaf48,
+  0xae40, 0x8c38, 0x8b30, 0x6828, 0x4518, 0x2310, 0x2208, 0x2208, 0x2310, 0x4618, 0x6928, 0xae40,
+  0xf360, 0x1871, 0x3979, 0x1979, 0x1769, 0xae40, 0x6828, 0x8003, 0x4618, 0x0001, 0x0100, 0x800f,
+  0x0000, 0x0001, 0x0100, 0x804f, 0x0000, 0x0003, 0x2308, 0x6a30, 0xd358, 0x800c, 0x1979, 0x0002,
+  0x1871, 0x1871, 0x8005, 0x1979, 0x0014, 0x1871, 0xf770, 0xd360, 0xb048, 0x8b30, 0x4618, 0x2310,
+  0x2208, 0x4618, 0xb150, 0xf560, 0x1771, 0x1979, 0xf770, 0xb150, 0x6a30, 0x2410, 0x4518, 0x6828,
+  0x0100, 0x805b, 0x0000, 0x0003, 0x4618, 0xb048, 0xf870, 0x8006, 0x1979, 0x8004, 0x1a79, 0x8004,
+  0x1979, 0x0002, 0xf770, 0x1871, 0x8005, 0x1979, 0x000d, 0x1a79, 0x3a79, 0x1979, 0x1a79, 0x1979,
+  0x3979, 0x1871, 0xf668, 0xd458, 0xf560, 0xf560, 0xf668, 0x1879, 0x8003, 0x1979, 0x0005, 0xf460,
+  0x8d38, 0x8d38, 0x4618, 0x2308, 0x8015, 0x0000, 0x0002, 0x2310, 0x0100, 0x8041, 0x0000, 0x0009,
+  0x2410, 0xaf48, 0xf878, 0xf978, 0x1979, 0xf870, 0xf870, 0x1879, 0x1979, 0x8003, 0x1a79, 0x0001,
+  0x1979, 0x8005, 0x1a79, 0x8004, 0x1979, 0x0005, 0x3979, 0x1979, 0x1a79, 0x1a79, 0x3a79, 0x8003,
+  0x3a81, 0x0001, 0x3a79, 0x8004, 0x1a79, 0x8003, 0x1979, 0x0002, 0x1a79, 0x3a79, 0x8003, 0x1a79,
+  0x0008, 0x1979, 0x1871, 0xf568, 0xd048, 0x8b30, 0x2308, 0x0000, 0x0100, 0x8009, 0x0000, 0x0001,
+  0x4518, 0x8048, 0x0000, 0x000c, 0x4518, 0xaf48, 0xf770, 0xf978, 0xf878, 0xf870, 0xf870, 0x1871,
+  0x1979, 0x1979, 0x1a79, 0x1a79, 0x8003, 0x1979, 0x0001, 0x3a79, 0x8004, 0x1a79, 0x0005, 0x3979,
+  0x1979, 0x3979, 0x1979, 0x1871, 0x8004, 0x1979, 0x0003, 0x1a79, 0x1a79, 0x3a81, 0x8005, 0x3a79,
+  0x0001, 0x1a79, 0x8003, 0x1979, 0x0001, 0x3a79, 0x8006, 0x1a79, 0x0007, 0x1979, 0x1871, 0xd258,
+  0x4618, 0x2410, 0x4518, 0x0100, 0x8007, 0x0000, 0x0001, 0x0208, 0x8034, 0x0000, 0x0001, 0x0100,
+  0x8011, 0x0000, 0x000b, 0x0108, 0xaf48, 0xf768, 0xf770, 0xf870, 0xf770, 0xf870, 0x1979, 0x1979,
+  0x1a79, 0x1a79, 0x8008, 0x1979, 0x001a, 0x1871, 0x1771, 0xf668, 0xf460, 0xd358, 0xd358, 0xb150,
+  0x6820, 0xd150, 0xb048, 0xd150, 0xd358, 0xf668, 0x1771, 0x1871, 0x1979, 0x3a79, 0x3979, 0x3a79,
+  0x3a79, 0x3a81, 0x1a79, 0x1a79, 0x1979, 0x1a79, 0x3a81, 0x8005, 0x1a79, 0x0008, 0x3a81, 0x1a79,
+  0x1979, 0x1979, 0xf568, 0xae48, 0x4620, 0x0100, 0x8016, 0x0000, 0x0001, 0x4518, 0x8034, 0x0000,
+  0x0009, 0x2208, 0x8a30, 0xd358, 0xf770, 0xf668, 0xf770, 0xf870, 0xf870, 0x1979, 0x8003, 0x1a79,
+  0x8003, 0x1979, 0x0009, 0x1879, 0x1769, 0xd358, 0xaf48, 0x6a30, 0x4620, 0x6720, 0x4518, 0x0100,
+  0x8009, 0x0000, 0x0009, 0x0100, 0x2208, 0x4518, 0x8c38, 0xd250, 0x1669, 0x1979, 0x3979, 0x1979,
+  0x8005, 0x1a79, 0x0007, 0x1a81, 0x3a79, 0x1871, 0x1871, 0x1979, 0x1a79, 0x3a79, 0x8004, 0x1a79,
+  0x0003, 0x1771, 0xaf48, 0x2310, 0x8014, 0x0000, 0x0002, 0x2308, 0x2310, 0x8023, 0x0000, 0x0001,
+  0x0100, 0x800f, 0x0000, 0x0018, 0x4820, 0xd358, 0xd250, 0xae40, 0xaf48, 0xd258, 0x1871, 0x1979,
+  0xf978, 0x1979, 0x1a79, 0x1a79, 0x1979, 0x1979, 0xf668, 0xaf48, 0x4820, 0x2310, 0x0100, 0x0100,
+  0x2310, 0x4618, 0x4618, 0x0108, 0x800f, 0x0000, 0x0019, 0x0108, 0x4410, 0x8a30, 0xd358, 0x1871,
+  0x1a79, 0x1979, 0x1a79, 0x1a79, 0x3a81, 0x1a79, 0x1979, 0x1871, 0x1979, 0x1a79, 0x1a79, 0x3a79,
+  0x3a79, 0x1a79, 0x1a79, 0x3a79, 0x3979, 0xf668, 0x8c38, 0x2208, 0x8045, 0x0000, 0x0008, 0x2208,
+  0x8c38, 0xd460, 0xb048, 0x4618, 0x8b30, 0xf668, 0xf870, 0x8003, 0x1979, 0x0009, 0x1a79, 0x1979,
+  0xf870, 0xd358, 0x8c38, 0x6928, 0x4618, 0x4518, 0x2208, 0x8019, 0x0000, 0x000b, 0x2310, 0x6a30,
+  0xd358, 0x1879, 0x3a81, 0x1a81, 0x1a79, 0x1a79, 0x3a79, 0x1979, 0x3a81, 0x8004, 0x3a79, 0x0007,
+  0x1a79, 0x3a79, 0x1a79, 0x1979, 0x1a79, 0xd358, 0x0208, 0x803d, 0x0000, 0x0001, 0x0100, 0x8005,
+  0x0000, 0x0008, 0x2410, 0x6a30, 0x8f48, 0x6928, 0x4820, 0x8d38, 0xf668, 0xf878, 0x8004, 0x1979,
+  0x0006, 0xf870, 0xd150, 0x6820, 0x6a30, 0x6828, 0x2208, 0x801f, 0x0000, 0x0006, 0x2310, 0x8c38,
+  0x1669, 0x3a81, 0x3a81, 0x3a79, 0x8004, 0x3a81, 0x8003, 0x1a79, 0x0007, 0x3a81, 0x3a79, 0x1a79,
+  0x1979, 0x1a79, 0xb048, 0x2308, 0x800a, 0x0000, 0x0001, 0x0100, 0x8036, 0x0000, 0x0008, 0x4620,
+  0xb048, 0x4620, 0x2310, 0x6828, 0xd460, 0xf970, 0xf970, 0x8003, 0x1979, 0x0006, 0x1871, 0xd258,
+  0x4518, 0x0000, 0x2208, 0x0100, 0x8023, 0x0000, 0x0005, 0x0100, 0x6828, 0xf358, 0x1979, 0x1a79,
+  0x8005, 0x3a81, 0x0003, 0x1a81, 0x3a81, 0x1a81, 0x8004, 0x3a81, 0x0002, 0xf668, 0x6928, 0x803f,
+  0x0000, 0x0007, 0x0208, 0x8d40, 0x6828, 0x0108, 0x8b30, 0xf770, 0xf870, 0x8003, 0xf978, 0x0003,
+  0xf870, 0xd560, 0x4828, 0x802b, 0x0000, 0x0005, 0x4618, 0xd258, 0x1979, 0x3a81, 0x1a81, 0x8003,
+  0x3a81, 0x0009, 0x1a79, 0x3a79, 0x1979, 0x3a79, 0x1979, 0x1a79, 0x1979, 0x1979, 0x6a30, 0x803d,
+  0x0000, 0x0007, 0x0100, 0x6b30, 0x6820, 0x2308, 0x8f48, 0x1971, 0xf970, 0x8004, 0xf870, 0x0002,
+  0x8d40, 0x2208, 0x802e, 0x0000, 0x0010, 0x4618, 0xd358, 0x1a79, 0x1a81, 0x3a81, 0x3a81, 0x1a79,
+  0x1771, 0xf768, 0x1979, 0x1979, 0x1a79, 0x1a79, 0x1979, 0x1871, 0x8e40, 0x8037, 0x0000, 0x0001,
+  0x2518, 0x8004, 0x0000, 0x000b, 0x4620, 0x2410, 0x2208, 0xb250, 0xf978, 0xf970, 0xf870, 0xf770,
+  0xf768, 0xd458, 0x4720, 0x8032, 0x0000, 0x000f, 0x6828, 0xf568, 0x1a79, 0x3a81, 0x3a81, 0x1979,
+  0x1871, 0xf560, 0x1979, 0x3a79, 0x3a81, 0x3a81, 0x3a79, 0x3979, 0x8b38, 0x8035, 0x0000, 0x0002,
+  0x2410, 0x6b38, 0x8003, 0x0000, 0x000b, 0x2310, 0x0000, 0x2208, 0x8c38, 0xf870, 0xf978, 0xf870,
+  0xf870, 0xf768, 0x8c38, 0x0208, 0x8034, 0x0000, 0x000a, 0x2208, 0xae40, 0x1979, 0x3a81, 0x3a81,
+  0x3a79, 0x1979, 0x1769, 0xf460, 0x1a79, 0x8003, 0x3a81, 0x0002, 0x3979, 0x6928, 0x800a, 0x0000,
+  0x0001, 0x0100, 0x800d, 0x0000, 0x0001, 0x2000, 0x8017, 0x0000, 0x0001, 0x0100, 0x8009, 0x0000,
+  0x0008, 0x0108, 0x4518, 0xb150, 0xf978, 0xf870, 0xf870, 0xd560, 0x4720, 0x8013, 0x0000, 0x000f,
+  0x2310, 0x4618, 0x6720, 0x6928, 0x6720, 0x2208, 0x0000, 0x0108, 0x0100, 0x2310, 0x2410, 0x2410,
+  0x8a30, 0x4518, 0x0100, 0x8016, 0x0000, 0x0009, 0x6828, 0x1771, 0x1a79, 0x3a81, 0x3a79, 0x3979,
+  0xf460, 0xd358, 0x3a79, 0x8003, 0x3a81, 0x0002, 0x1979, 0x8c38, 0x8008, 0x0000, 0x0002, 0x4618,
+  0x6b30, 0x802e, 0x0000, 0x0008, 0x0108, 0x4518, 0xb150, 0xf870, 0xf970, 0xf870, 0xb250, 0x2310,
+  0x8013, 0x0000, 0x0013, 0x0100, 0x2208, 0x2310, 0x4618, 0x8b38, 0x8e40, 0xd150, 0x8b38, 0x6928,
+  0x6a30, 0x4720, 0x2310, 0x2208, 0x8b38, 0x6b30, 0xd048, 0xaf48, 0x6928, 0x2208, 0x8014, 0x0000,
+  0x0003, 0x2410, 0xf460, 0x1979, 0x8003, 0x3a79, 0x0008, 0xf560, 0xf460, 0x3a81, 0x3a81, 0x3a79,
+  0x1a79, 0x1669, 0x6928, 0x8008, 0x0000, 0x0005, 0x0100, 0x0000, 0x0000, 0x4000, 0x2000, 0x800a,
+  0x0000, 0x0002, 0x2000, 0x2000, 0x801e, 0x0000, 0x0007, 0x2308, 0xb150, 0xf870, 0xf768, 0xb258,
+  0xd250, 0x2308, 0x8014, 0x0000, 0x0003, 0x6a30, 0xf560, 0x1871, 0x8005, 0x1979, 0x000e, 0x1871,
+  0x1669, 0xd358, 0xae40, 0x6a30, 0x4720, 0x2518, 0x4618, 0xaf48, 0xf668, 0x1771, 0xd150, 0x4720,
+  0x2410, 0x8012, 0x0000, 0x0003, 0x2310, 0xd150, 0x1871, 0x8003, 0x3a79, 0x0008, 0xf568, 0x3871,
+  0x3a81, 0x3a79, 0x3a79, 0x1871, 0x8a30, 0x2310, 0x800a, 0x0000, 0x0002, 0xa211, 0xe108, 0x802a,
+  0x0000, 0x0006, 0x8c38, 0xf870, 0xf770, 0x6b38, 0x6b30, 0x0100, 0x800f, 0x0000, 0x000b, 0x2208,
+  0x2208, 0x0000, 0x2208, 0x6928, 0xd258, 0xf770, 0x1871, 0x1771, 0x1871, 0x1879, 0x8004, 0x1979,
+  0x000f, 0x3a79, 0x3a79, 0x3a81, 0x1979, 0x1979, 0x1871, 0xf668, 0xf460, 0xf568, 0x1879, 0x1979,
+  0x1979, 0x1879, 0xd358, 0x4720, 0x8010, 0x0000, 0x000f, 0x2208, 0x2308, 0xaf48, 0x1771, 0x3a79,
+  0x3a81, 0x3a79, 0x1871, 0x1a79, 0x3a81, 0x1a79, 0x3a81, 0xd150, 0x2208, 0x0100, 0x8035, 0x0000,
+  0x0005, 0x4820, 0xb358, 0x4820, 0x4410, 0x2208, 0x800d, 0x0000, 0x0009, 0x0208, 0x0100, 0x0000,
+  0x0100, 0x4720, 0xb150, 0xf768, 0x1979, 0x1979, 0x8003, 0x1871, 0x8003, 0x1979, 0x0002, 0x1871,
+  0x1879, 0x8004, 0x1979, 0x0003, 0x1a79, 0x3979, 0x1979, 0x8003, 0x1871, 0x0001, 0x1971, 0x8004,
+  0x1979, 0x0004, 0x1871, 0xd150, 0x4720, 0x0100, 0x800e, 0x0000, 0x000f, 0x4410, 0x0108, 0x8c38,
+  0x3979, 0x3a81, 0x3a81, 0x1979, 0x1979, 0x3a81, 0x3a81, 0x3a79, 0x3979, 0x6928, 0x0100, 0x2310,
+  0x8035, 0x0000, 0x0001, 0x0100, 0x800f, 0x0000, 0x0009, 0x0100, 0x6928, 0x4618, 0x8c38, 0xd460,
+  0xf568, 0xf568, 0xf770, 0x1871, 0x8005, 0x1979, 0x000d, 0x1871, 0xd258, 0x8c38, 0xb050, 0xf460,
+  0xf568, 0xf568, 0x1871, 0x1979, 0x1769, 0xd258, 0xf668, 0x1871, 0x8007, 0x1979, 0x0005, 0x1871,
+  0xf770, 0xd150, 0x4720, 0x2208, 0x800d, 0x0000, 0x000e, 0x2310, 0x0100, 0x8c38, 0x3979, 0x3a79,
+  0x3a79, 0x3979, 0x3979, 0x3a79, 0x3a79, 0x3979, 0x1771, 0x2310, 0x2310, 0x8020, 0x0000, 0x0001,
+  0x2000, 0x8024, 0x0000, 0x0008, 0x6928, 0xd258, 0xf870, 0x1979, 0xf770, 0xd460, 0xf770, 0xf978,
+  0x8006, 0x1979, 0x0003, 0x1879, 0x1979, 0x1871, 0x8003, 0x1979, 0x000a, 0x1879, 0x1669, 0x1871,
+  0x1871, 0xd360, 0xd258, 0xf560, 0xf768, 0xf568, 0xf770, 0x8006, 0x1979, 0x0005, 0x1879, 0xd358,
+  0x8c38, 0x8d40, 0x4618, 0x800c, 0x0000, 0x000d, 0x2310, 0x0100, 0x8c38, 0x3979, 0x3979, 0x1979,
+  0x1669, 0x1771, 0x3a79, 0x1879, 0x3a79, 0xb048, 0x0100, 0x8020, 0x0000, 0x0001, 0x8000, 0x8008,
+  0x0000, 0x0001, 0x6000, 0x801a, 0x0000, 0x0021, 0x6b30, 0xf768, 0xf978, 0x1979, 0x1871, 0xf870,
+  0xf978, 0x1979, 0xf978, 0x1879, 0xf668, 0xd460, 0xd150, 0xd358, 0xf568, 0xf360, 0xb050, 0xb050,
+  0xb048, 0xb048, 0xad40, 0x8c38, 0xad40, 0xaf48, 0xd150, 0xd358, 0xf668, 0x1879, 0x1871, 0xf560,
+  0xd258, 0xd150, 0xf668, 0x8006, 0x1979, 0x0005, 0x8d40, 0x2310, 0x8b30, 0x8e40, 0x2518, 0x800b,
+  0x0000, 0x0008, 0x4410, 0x0100, 0xae40, 0x3979, 0x1871, 0x1771, 0xae40, 0x3979, 0x8003, 0x1979,
+  0x0004, 0x4720, 0x0000, 0x0000, 0x4518, 0x8026, 0x0000, 0x0001, 0x2000, 0x8019, 0x0000, 0x0003,
+  0x6828, 0xf768, 0x1871, 0x8003, 0xf870, 0x000b, 0x1871, 0x1979, 0xf568, 0xaf48, 0x6928, 0x6828,
+  0x8b38, 0x8a30, 0x6928, 0x4518, 0x0100, 0x800a, 0x0000, 0x000b, 0x0208, 0x4518, 0xad40, 0xf560,
+  0x1879, 0xf568, 0xf668, 0xf668, 0xd258, 0xd460, 0x1871, 0x8003, 0x1979, 0x0005, 0xae40, 0x0100,
+  0x2410, 0xaf48, 0x2308, 0x800a, 0x0000, 0x000e, 0x0100, 0x2410, 0x0100, 0xd150, 0x3979, 0x3979,
+  0xd258, 0xf360, 0x3a81, 0x3a79, 0x1979, 0xd460, 0x2208, 0x0100, 0x8040, 0x0000, 0x000e, 0x4620,
+  0xd668, 0xf870, 0x1871, 0x1979, 0x1979, 0xf870, 0xd150, 0x4720, 0x4518, 0x6720, 0x6a30, 0x4618,
+  0x2208, 0x8011, 0x0000, 0x0009, 0x0100, 0x6820, 0xf360, 0x1879, 0x1879, 0xf568, 0xd358, 0xd560,
+  0xf770, 0x8003, 0x1979, 0x0005, 0xd358, 0x4518, 0x2208, 0x6828, 0x4518, 0x800a, 0x0000, 0x000d,
+  0x2208, 0x2308, 0x2310, 0x1669, 0x1979, 0x3979, 0xad40, 0x1771, 0x3a79, 0x1a79, 0x3979, 0x6720,
+  0x0100, 0x8014, 0x0000, 0x0001, 0x4000, 0x8029, 0x0000, 0x0009, 0x0108, 0x8c38, 0xf768, 0xf870,
+  0xf970, 0x1979, 0x1871, 0xaf48, 0x2518, 0x8003, 0x2208, 0x8017, 0x0000, 0x0010, 0x0100, 0x6820,
+  0xd358, 0x1771, 0xf768, 0x1771, 0xf770, 0xf770, 0xf870, 0x1979, 0x1871, 0x1771, 0x8c38, 0x2208,
+  0x6a28, 0x4720, 0x800a, 0x0000, 0x000c, 0x6720, 0x2308, 0x8b30, 0x1979, 0x3979, 0xd150, 0x8d40,
+  0x1a79, 0x1979, 0x3a79, 0xaf48, 0x0100, 0x8012, 0x0000, 0x0007, 0x2000, 0xc108, 0xa008, 0x2000,
+  0xe108, 0xa108, 0x2109, 0x8024, 0x0000, 0x0002, 0x2410, 0xb150, 0x8004, 0xf870, 0x0007, 0xb250,
+  0x4618, 0x2108, 0x2310, 0x0108, 0x0000, 0x0100, 0x8019, 0x0000, 0x000f, 0x0100, 0x6928, 0xf460,
+  0xf770, 0x1979, 0x1979, 0xf770, 0xf870, 0x1979, 0x1879, 0x1871, 0xd258, 0x4720, 0x6828, 0x4518,
+  0x8009, 0x0000, 0x000c, 0x6928, 0x8b38, 0x2208, 0xd050, 0x1979, 0x1871, 0x6928, 0xf668, 0x1a79,
+  0x3a79, 0x1669, 0x2308, 0x8013, 0x0000, 0x0009, 0x2000, 0x6109, 0x2323, 0x042c, 0x642b, 0xe534,
+  0x8111, 0xe108, 0x2000, 0x8020, 0x0000, 0x0009, 0x6a30, 0xf358, 0xf870, 0x1871, 0x1871, 0xd250,
+  0x4720, 0x0208, 0x2208, 0x8020, 0x0000, 0x000e, 0x2208, 0xae48, 0x1871, 0x1879, 0x1879, 0xf770,
+  0x1979, 0x1979, 0x1871, 0x1871, 0x1771, 0x8d38, 0x6928, 0x4518, 0x8009, 0x0000, 0x000b, 0x2208,
+  0x0108, 0x4410, 0xb048, 0x1871, 0xd050, 0xae40, 0x3979, 0x1a79, 0x1979, 0xae40, 0x8015, 0x0000,
+  0x0008, 0x2212, 0xc534, 0x453d, 0xc545, 0x8434, 0xe211, 0x0109, 0x6000, 0x801f, 0x0000, 0x0008,
+  0x6720, 0xaf48, 0xf560, 0xf568, 0x6828, 0x0000, 0x0000, 0x0100, 0x8023, 0x0000, 0x0005, 0x4620,
+  0xd358, 0xf870, 0x1871, 0x1871, 0x8005, 0x1979, 0x0002, 0x8c38, 0x4410, 0x800b, 0x0000, 0x000a,
+  0x0100, 0x2310, 0xf560, 0x1871, 0xaf48, 0xf770, 0x1979, 0x1979, 0xf560, 0x2410, 0x8008, 0x0000,
+  0x0002, 0x2310, 0x2310, 0x8009, 0x0000, 0x000a, 0x2000, 0x2000, 0x021a, 0x053d, 0x853d, 0xc545,
+  0x453d, 0x621a, 0xc108, 0xa108, 0x8017, 0x0000, 0x0001, 0x0208, 0x8006, 0x0000, 0x0004, 0x2410,
+  0x8c38, 0xaf48, 0x4518, 0x8028, 0x0000, 0x0007, 0x2208, 0xb048, 0xf870, 0x1871, 0xf668, 0xf668,
+  0x1879, 0x8003, 0x1979, 0x0002, 0x6b30, 0x0100, 0x800a, 0x0000, 0x000a, 0x2108, 0x2208, 0x6828,
+  0x1879, 0x1771, 0xf668, 0xf668, 0x1979, 0xad40, 0x2208, 0x8015, 0x0000, 0x000a, 0x6000, 0xa111,
+  0xc534, 0x853d, 0x653d, 0x653d, 0xc434, 0xe322, 0x8211, 0xe108, 0x8012, 0x0000, 0x0002, 0x2000,
+  0x2000, 0x8008, 0x0000, 0x0003, 0x0100, 0x6720, 0x2308, 0x802a, 0x0000, 0x000c, 0x0100, 0x8d40,
+  0x1871, 0xf870, 0xf668, 0xf568, 0x1879, 0x1979, 0x1979, 0x1879, 0x8c38, 0x0100, 0x800a, 0x0000,
+  0x0009, 0x0100, 0x0100, 0xf360, 0x1979, 0x1871, 0xf460, 0x1871, 0x1771, 0x6a30, 0x8016, 0x0000,
+  0x000a, 0xa108, 0xc108, 0x821a, 0x853d, 0x653d, 0x253d, 0x653d, 0x053d, 0x242c, 0x4109, 0x8013,
+  0x0000, 0x0002, 0xc108, 0x4000, 0x801a, 0x0000, 0x000d, 0x0108, 0x2410, 0x4720, 0x4720, 0x6a30,
+  0xad40, 0xb048, 0xd358, 0xd460, 0xb048, 0x6928, 0x2410, 0x0100, 0x800d, 0x0000, 0x000b, 0x0100,
+  0x8d38, 0xd358, 0x1871, 0xd668, 0xb048, 0xf770, 0x1979, 0x1979, 0xf770, 0x4518, 0x800c, 0x0000,
+  0x0007, 0x6928, 0x1871, 0x1979, 0xf560, 0xd358, 0x1879, 0xd250, 0x8017, 0x0000, 0x000b, 0x6000,
+  0xa108, 0x6111, 0x6434, 0x0546, 0xc545, 0x853d, 0xa545, 0x253d, 0x621a, 0x2000, 0x8012, 0x0000,
+  0x0002, 0x6111, 0x0109, 0x8017, 0x0000, 0x0012, 0x4618, 0x8e40, 0xd150, 0xaf48, 0x4720, 0x4518,
+  0x6828, 0xaf48, 0xd258, 0xf568, 0xf770, 0x1879, 0x1871, 0xf770, 0xf568, 0xd150, 0x6928, 0x0208,
+  0x800c, 0x0000, 0x000a, 0x2208, 0xb150, 0xf668, 0xd358, 0x8b30, 0x1871, 0x1979, 0xf870, 0xd358,
+  0x2208, 0x8009, 0x0000, 0x000a, 0x2208, 0x0000, 0x2310, 0xd460, 0x1979, 0xf568, 0x6a30, 0xf560,
+  0xd050, 0x0100, 0x8018, 0x0000, 0x000a, 0x6000, 0x0109, 0x821a, 0x453d, 0xe645, 0xc545, 0x0546,
+  0xe545, 0xa434, 0xa111, 0x8012, 0x0000, 0x0002, 0xa000, 0x8000, 0x8014, 0x0000, 0x0016, 0x4518,
+  0xad40, 0x8d40, 0x6a30, 0x8d40, 0xd150, 0x6928, 0x6a30, 0x4720, 0x8b30, 0xd460, 0x1871, 0x1879,
+  0xf770, 0xf770, 0xf668, 0xf870, 0x1979, 0x1979, 0xf668, 0x8c38, 0x2208, 0x800b, 0x0000, 0x0009,
+  0x2208, 0xd050, 0xb150, 0x6928, 0xd050, 0x1979, 0x1871, 0xf870, 0xb048, 0x800c, 0x0000, 0x0007,
+  0xb048, 0x1871, 0xd258, 0x6928, 0x4720, 0x6720, 0x0100, 0x8019, 0x0000, 0x000b, 0x2000, 0x2000,
+  0xa000, 0x432b, 0x253d, 0xc545, 0x0546, 0x0546, 0xc545, 0x4323, 0x8000, 0x8012, 0x0000, 0x0002,
+  0xc108, 0x4000, 0x8011, 0x0000, 0x0019, 0x6a30, 0xf560, 0xf568, 0xd358, 0xf668, 0xf770, 0xf560,
+  0x8b30, 0xaf48, 0xb050, 0xb050, 0xf768, 0x1879, 0x1979, 0x1879, 0xf870, 0x1871, 0xf770, 0xf870,
+  0x1979, 0x1979, 0xf878, 0xb150, 0x2308, 0x2308, 0x800a, 0x0000, 0x0009, 0x2410, 0xd258, 0xf560,
+  0xd358, 0x1771, 0x1879, 0x1771, 0xf668, 0x4720, 0x800b, 0x0000, 0x0006, 0x4720, 0xd150, 0x6928,
+  0x2208, 0x0000, 0x0100, 0x8014, 0x0000, 0x0002, 0xa000, 0x4109, 0x8007, 0x0000, 0x000a, 0xa108,
+  0x4111, 0xe322, 0x853d, 0xe545, 0x264e, 0x2646, 0x453d, 0x421a, 0x2000, 0x8005, 0x0000, 0x0001,
+  0x2000, 0x800b, 0x0000, 0x0002, 0xa108, 0x4000, 0x800e, 0x0000, 0x0013, 0x2208, 0xaf48, 0x1871,
+  0x1879, 0xf878, 0x1879, 0xf878, 0xf870, 0xf668, 0xd358, 0xb048, 0xae40, 0x8a30, 0x6a30, 0x6a30,
+  0xd258, 0xf668, 0xf770, 0xf770, 0x8004, 0x1979, 0x0006, 0x1879, 0x1871, 0xd358, 0x8b30, 0x2208,
+  0x2208, 0x8009, 0x0000, 0x0002, 0x6a30, 0x1871, 0x8003, 0x1879, 0x0004, 0xf770, 0xaf48, 0xb048,
+  0x2208, 0x800a, 0x0000, 0x0003, 0x0100, 0x8c38, 0x4518, 0x8017, 0x0000, 0x0002, 0x2000, 0x8000,
+  0x8008, 0x0000, 0x0012, 0x6000, 0x4000, 0x8111, 0x8434, 0xe545, 0x2546, 0x254e, 0x264e, 0x042c,
+  0x6000, 0x2000, 0x0000, 0xa000, 0xc322, 0x042c, 0xe322, 0xe211, 0xa008, 0x8009, 0x0000, 0x0001,
+  0x2000, 0x800d, 0x0000, 0x0021, 0x2518, 0xd460, 0xf870, 0x1979, 0x1879, 0x1879, 0xf870, 0xf568,
+  0xd460, 0xd150, 0xae40, 0x8e40, 0x8d38, 0x8b30, 0x8b38, 0x8c38, 0xd150, 0xd460, 0xd050, 0x6720,
+  0x4720, 0x8e40, 0xd460, 0x1879, 0x1871, 0xf878, 0xf870, 0xf568, 0x4620, 0x4618, 0x0100, 0x2310,
+  0x0100, 0x8007, 0x0000, 0x0001, 0xaf48, 0x8003, 0x1979, 0x0004, 0x1879, 0x8f48, 0x4618, 0x6928,
+  0x8031, 0x0000, 0x000f, 0x2000, 0x4109, 0xe42b, 0xe545, 0x464e, 0x664e, 0x4434, 0xc211, 0xa111,
+  0xe53c, 0x464e, 0x664e, 0x2646, 0x653d, 0x2323, 0x800a, 0x0000, 0x0002, 0x4000, 0x6000, 0x800a,
+  0x0000, 0x0002, 0x4518, 0xd560, 0x8004, 0xf870, 0x0004, 0xf770, 0xb150, 0x2410, 0x0100, 0x8008,
+  0x0000, 0x0011, 0x0100, 0x2208, 0x4618, 0x2310, 0x4518, 0x0108, 0x6928, 0xf668, 0xf870, 0x1979,
+  0x1871, 0xd568, 0x6828, 0x6820, 0x2208, 0x6828, 0x0100, 0x8006, 0x0000, 0x0009, 0x2208, 0xf568,
+  0x1879, 0xf770, 0xf870, 0xf770, 0x2410, 0x6828, 0x0100, 0x8033, 0x0000, 0x0003, 0x0109, 0x0434,
+  0x2646, 0x8003, 0x664e, 0x0007, 0x864e, 0x664e, 0x664e, 0x464e, 0x864e, 0xc534, 0x2000, 0x800a,
+  0x0000, 0x0002, 0x8000, 0xc108, 0x8008, 0x0000, 0x0009, 0x4618, 0xd568, 0xf870, 0xf568, 0xf560,
+  0xf668, 0xb050, 0x4618, 0x0100, 0x800e, 0x0000, 0x0005, 0x2208, 0x2308, 0x2208, 0x4720, 0xf668,
+  0x8003, 0x1879, 0x0005, 0xb048, 0x6820, 0x6a30, 0x2208, 0x4720, 0x8007, 0x0000, 0x0008, 0x4720,
+  0x1871, 0xf870, 0xf668, 0x1871, 0x8d40, 0x2310, 0x2410, 0x800b, 0x0000, 0x0001, 0x0100, 0x8029,
+  0x0000, 0x000b, 0x8111, 0x053d, 0xe645, 0xa64e, 0x864e, 0x2646, 0x664e, 0xa545, 0x0646, 0x0646,
+  0xa000, 0x800b, 0x0000, 0x0002, 0x4000, 0x4000, 0x8006, 0x0000, 0x0007, 0x2410, 0xf460, 0xf768,
+  0xd150, 0x2410, 0x8b30, 0x4618, 0x8014, 0x0000, 0x000b, 0x0100, 0xae40, 0xf668, 0x1879, 0x1979,
+  0x1879, 0x6b30, 0x6720, 0x4720, 0x4518, 0x2208, 0x8007, 0x0000, 0x0001, 0x8e40, 0x8003, 0xf870,
+  0x0003, 0xd568, 0x2310, 0x6820, 0x8036, 0x0000, 0x0005, 0xa008, 0xe42b, 0xa74e, 0xa74e, 0x664e,
+  0x8003, 0x864e, 0x0002, 0x8545, 0x6000, 0x800b, 0x0000, 0x0001, 0x2000, 0x8007, 0x0000, 0x0006,
+  0x4410, 0xaf48, 0x4518, 0x2208, 0x4518, 0x0108, 0x8016, 0x0000, 0x000a, 0x2310, 0xaf48, 0xf870,
+  0xf878, 0xf878, 0xf870, 0xad40, 0x6928, 0x2208, 0x0100, 0x8007, 0x0000, 0x0008, 0x2208, 0xf568,
+  0xf978, 0x1871, 0xf870, 0x8d40, 0x4618, 0x0108, 0x8036, 0x0000, 0x0009, 0x0323, 0xc756, 0xc74e,
+  0xa74e, 0xa64e, 0x864e, 0xa64e, 0x8534, 0x8000, 0x8014, 0x0000, 0x0003, 0x0100, 0x0108, 0x4518,
+  0x8019, 0x0000, 0x0008, 0x0108, 0xb048, 0xf870, 0xf878, 0xf870, 0xf870, 0x8f40, 0x2310, 0x8005,
+  0x0000, 0x0001, 0x2208, 0x8003, 0x0000, 0x0001, 0x8c38, 0x8003, 0xf870, 0x0003, 0xd460, 0x2208,
+  0x0100, 0x8032, 0x0000, 0x0007, 0x2000, 0x2000, 0x4000, 0x0000, 0xa21a, 0xa74e, 0xc74e, 0x8004,
+  0xa64e, 0x0004, 0x453d, 0x221a, 0x8211, 0xa108, 0x8013, 0x0000, 0x0001, 0x4410, 0x801b, 0x0000,
+  0x0003, 0x0100, 0x8c38, 0xf878, 0x8003, 0xf870, 0x0007, 0x6820, 0x2310, 0x0000, 0x0000, 0x0108,
+  0x2208, 0x2208, 0x8003, 0x0000, 0x0007, 0x2208, 0xf568, 0x1871, 0xf870, 0xf770, 0x4518, 0x2208,
+  0x8031, 0x0000, 0x0006, 0x642b, 0x6534, 0x042c, 0x663d, 0x4323, 0x6534, 0x8003, 0xc74e, 0x0009,
+  0xc756, 0x874e, 0xe645, 0x864e, 0x264e, 0x2434, 0x8322, 0x031a, 0xa008, 0x8007, 0x0000, 0x0001,
+  0x4000, 0x8003, 0x0000, 0x0002, 0x2000, 0x4000, 0x8005, 0x0000, 0x0001, 0x2410, 0x801c, 0x0000,
+  0x0001, 0xaf48, 0x8003, 0xf870, 0x0002, 0xb150, 0x0108, 0x8009, 0x0000, 0x0005, 0x6928, 0xf668,
+  0xd258, 0x4720, 0x2208, 0x8023, 0x0000, 0x0001, 0x4000, 0x800d, 0x0000, 0x0003, 0x2000, 0xe53c,
+  0xc756, 0x8003, 0xe756, 0x0010, 0x0857, 0xe856, 0x0646, 0xe756, 0x874e, 0xa42b, 0xc108, 0x8322,
+  0x653d, 0x864e, 0xc545, 0x4434, 0x6534, 0xe42b, 0x421a, 0xc108, 0x8009, 0x0000, 0x0001, 0x4000,
+  0x8022, 0x0000, 0x0008, 0x0100, 0xb150, 0xf770, 0xf770, 0x1871, 0x4618, 0x0000, 0x0100, 0x8008,
+  0x0000, 0x0003, 0x4720, 0x6928, 0x0100, 0x8032, 0x0000, 0x000b, 0x0109, 0x2646, 0x0857, 0x0857,
+  0xe756, 0x0857, 0x285f, 0x285f, 0x085f, 0xa856, 0xe211, 0x8003, 0x0000, 0x000a, 0x6000, 0x421a,
+  0xe53c, 0x464e, 0xe645, 0x8645, 0x0646, 0xa545, 0x4323, 0xa000, 0x802b, 0x0000, 0x0007, 0x2310,
+  0xf560, 0xf770, 0xf770, 0xd360, 0x8c38, 0x2410, 0x8008, 0x0000, 0x0001, 0x0100, 0x802c, 0x0000,
+  0x0002, 0x2000, 0x2000, 0x8005, 0x0000, 0x0007, 0x2000, 0xa53c, 0xe856, 0x0857, 0xc74e, 0xc756,
+  0x0857, 0x8003, 0x285f, 0x0003, 0x085f, 0xc53c, 0xc108, 0x8004, 0x0000, 0x0009, 0x4000, 0x421a,
+  0x253d, 0x464e, 0x2646, 0x0646, 0x0646, 0xe53c, 0x6111, 0x801a, 0x0000, 0x0003, 0x8000, 0x2000,
+  0x4000, 0x800e, 0x0000, 0x0001, 0x4820, 0x8003, 0xf770, 0x0001, 0x6928, 0x8037, 0x0000, 0x0001,
+  0x4000, 0x8005, 0x0000, 0x0001, 0xe322, 0x8003, 0x0857, 0x000a, 0xc74e, 0xe756, 0x0857, 0x0857,
+  0x2857, 0x0857, 0x285f, 0x085f, 0x6645, 0x4109, 0x8005, 0x0000, 0x0009, 0xc108, 0x221a, 0x053d,
+  0xe645, 0xc42b, 0xe53c, 0xa545, 0xa222, 0x4000, 0x8016, 0x0000, 0x0006, 0x4111, 0x0323, 0xa534,
+  0xa008, 0x8211, 0x4000, 0x800e, 0x0000, 0x0004, 0x8e40, 0xd568, 0xf770, 0x6820, 0x8009, 0x0000,
+  0x0001, 0x2000, 0x8032, 0x0000, 0x0005, 0xe108, 0x674e, 0xe856, 0x874e, 0xc756, 0x8005, 0x0857,
+  0x0006, 0xe856, 0x674e, 0xe756, 0xc756, 0x453d, 0x2000, 0x8004, 0x0000, 0x000b, 0xa108, 0x4000,
+  0x6000, 0xa222, 0x453d, 0x8545, 0x6534, 0x053d, 0xc53c, 0x221a, 0x4000, 0x8012, 0x0000, 0x0007,
+  0x2000, 0x0323, 0x253d, 0x464e, 0xc322, 0x2109, 0xa008, 0x800f, 0x0000, 0x0004, 0x2410, 0x8e40,
+  0x8d40, 0x2208, 0x8008, 0x0000, 0x0003, 0x6111, 0x8000, 0x4000, 0x8008, 0x0000, 0x0001, 0x2000,
+  0x8028, 0x0000, 0x0005, 0x0534, 0x0857, 0xa645, 0xe645, 0xc756, 0x8003, 0x0857, 0x0008, 0x0757,
+  0xe756, 0x8645, 0xe42b, 0x0646, 0x674e, 0x253d, 0x6000, 0x8008, 0x0000, 0x0008, 0xa008, 0x421a,
+  0x053d, 0x8545, 0xe53c, 0x253d, 0xa434, 0x8111, 0x8010, 0x0000, 0x0007, 0x2000, 0x0323, 0xe545,
+  0x264e, 0xe53c, 0xe219, 0x221a, 0x8010, 0x0000, 0x0002, 0x0100, 0x4410, 0x800a, 0x0000, 0x0001,
+  0xa108, 0x800a, 0x0000, 0x0001, 0xc108, 0x8027, 0x0000, 0x0007, 0x021a, 0xe856, 0xc756, 0xe645,
+  0x464e, 0x874e, 0xc756, 0x8004, 0xe756, 0x0005, 0x464e, 0xe53c, 0xa53d, 0x642b, 0xc108, 0x800b,
+  0x0000, 0x0007, 0x6000, 0x821a, 0x053d, 0x453d, 0xa545, 0x0646, 0x221a, 0x800e, 0x0000, 0x0008,
+  0x2000, 0x2323, 0xc545, 0xe53c, 0xc645, 0xa322, 0xc322, 0xa008, 0x804e, 0x0000, 0x0011, 0x6000,
+  0x8645, 0x0857, 0x664e, 0xe645, 0x0646, 0x664e, 0xc74e, 0xc756, 0xc756, 0xa74e, 0xc756, 0xa64e,
+  0x864e, 0x664e, 0x4323, 0x4000, 0x800b, 0x0000, 0x000a, 0x2000, 0x0000, 0x8000, 0x2323, 0x6545,
+  0xa545, 0xa434, 0x6000, 0x0000, 0x4000, 0x800a, 0x0000, 0x000b, 0x2000, 0x432b, 0x264e, 0xc545,
+  0x8545, 0x4545, 0x431a, 0xc322, 0x2000, 0x0000, 0x2000, 0x8038, 0x0000, 0x0006, 0x6000, 0x2000,
+  0x0000, 0x2000, 0x0000, 0x2000, 0x800e, 0x0000, 0x0013, 0xa008, 0x474e, 0xc756, 0x0646, 0xa645,
+  0xa645, 0x664e, 0x664e, 0xa74e, 0x664e, 0x864e, 0xa756, 0x864e, 0x864e, 0x664e, 0x464e, 0xc53c,
+  0xc211, 0x4000, 0x800d, 0x0000, 0x0007, 0xc108, 0x6111, 0xa111, 0x421a, 0xc008, 0x2000, 0xa108,
+  0x8008, 0x0000, 0x000c, 0x2000, 0x832b, 0x464e, 0x464e, 0x264e, 0x664e, 0x053d, 0xa211, 0x8111,
+  0xa008, 0x421a, 0x4109, 0x8030, 0x0000, 0x000c, 0x2000, 0x0111, 0x4211, 0xe210, 0xc108, 0x2000,
+  0x6000, 0xe108, 0x4434, 0x231a, 0xe211, 0x8211, 0x8003, 0x4000, 0x800d, 0x0000, 0x000e, 0x2000,
+  0xe53c, 0xc756, 0xa756, 0x474e, 0xa645, 0x664e, 0x864e, 0xa64e, 0x664e, 0x664e, 0xa64e, 0x664e,
+  0x864e, 0x8003, 0x664e, 0x0004, 0xe545, 0x4434, 0xe211, 0x8000, 0x8019, 0x0000, 0x000d, 0x2000,
+  0x432b, 0x264e, 0x664e, 0x264e, 0x664e, 0x464e, 0xc42b, 0x021a, 0xc211, 0x2434, 0x442b, 0x8000,
+  0x801f, 0x0000, 0x0002, 0x6000, 0xa008, 0x800d, 0x0000, 0x0011, 0x4000, 0x0211, 0xa211, 0x8322,
+  0x4322, 0x621a, 0x0323, 0x832b, 0x4434, 0x253d, 0x6545, 0x053d, 0x453d, 0x0434, 0x221a, 0x621a,
+  0x8211, 0x800e, 0x0000, 0x000b, 0x8111, 0x253d, 0xe756, 0x0857, 0xa756, 0xc756, 0xe756, 0xa64e,
+  0x864e, 0xa74e, 0xa74e, 0x8006, 0x664e, 0x0005, 0x264e, 0xa53c, 0x221a, 0xa108, 0x2000, 0x8016,
+  0x0000, 0x0002, 0x6000, 0xc32b, 0x8004, 0x464e, 0x0007, 0x664e, 0x4545, 0x221a, 0x2434, 0xa434,
+  0x2434, 0x4000, 0x801e, 0x0000, 0x0006, 0xe108, 0x832b, 0xc645, 0x0646, 0x4323, 0x4000, 0x8005,
+  0x0000, 0x0016, 0x2000, 0x8000, 0xc211, 0x821a, 0x831a, 0x832b, 0xa53c, 0x4545, 0xe64d, 0xa645,
+  0xc545, 0x253d, 0x4434, 0xe53c, 0xe53c, 0x053d, 0x453d, 0x253d, 0x6545, 0x631a, 0x6111, 0x8000,
+  0x8003, 0x0000, 0x0001, 0x4000, 0x800c, 0x0000, 0x000b, 0x4000, 0x8322, 0x274e, 0x285f, 0x0857,
+  0x0857, 0xe756, 0xc756, 0xc756, 0x874e, 0x0646, 0x8007, 0x664e, 0x0006, 0x264e, 0x6545, 0xe433,
+  0x631a, 0x0109, 0x2000, 0x8012, 0x0000, 0x0005, 0xa008, 0x6434, 0x464e, 0x664e, 0x664e, 0x8003,
+  0x464e, 0x0006, 0xc53c, 0x042b, 0x6545, 0x664e, 0xa42b, 0x2000, 0x801d, 0x0000, 0x000f, 0xe108,
+  0x8545, 0x864e, 0x4646, 0x853d, 0x0546, 0xc32b, 0xc008, 0xa000, 0x6111, 0xc322, 0x2434, 0xe43c,
+  0xa545, 0x264e, 0x8003, 0x464e, 0x000e, 0x264e, 0x464e, 0x264e, 0xe645, 0x0546, 0xe545, 0xa545,
+  0x0546, 0x264e, 0xa545, 0xc53c, 0x0323, 0x6111, 0x4000, 0x8014, 0x0000, 0x0003, 0xc108, 0xe433,
+  0x674e, 0x8003, 0x0857, 0x0005, 0xe756, 0x8534, 0x2109, 0x042c, 0x464e, 0x8007, 0x664e, 0x0006,
+  0x464e, 0x064e, 0x642b, 0x8211, 0x0109, 0x2000, 0x800f, 0x0000, 0x0003, 0x6000, 0x442b, 0x264e,
+  0x8005, 0x664e, 0x0007, 0x6434, 0x442b, 0x431a, 0xc545, 0x664e, 0xc545, 0x8000, 0x8017, 0x0000,
+  0x0001, 0x4000, 0x8005, 0x0000, 0x0001, 0x8323, 0x8004, 0x864e, 0x0006, 0x6646, 0x864e, 0x0646,
+  0x2646, 0x864e, 0x864e, 0x8004, 0x664e, 0x8003, 0x464e, 0x000d, 0x264e, 0x464e, 0x264e, 0x064e,
+  0xe545, 0xa434, 0x632b, 0x421a, 0x6111, 0x0109, 0xc108, 0x4000, 0x2000, 0x8014, 0x0000, 0x001a,
+  0x6000, 0x0000, 0x0000, 0xe108, 0xe433, 0x474e, 0x0857, 0x274e, 0x8111, 0x0000, 0x2000, 0xc222,
+  0xa545, 0x0646, 0x464e, 0x664e, 0x464e, 0x664e, 0x664e, 0x464e, 0x664e, 0xc545, 0x842b, 0x4111,
+  0xc211, 0xe108, 0x800d, 0x0000, 0x000f, 0x4000, 0xa111, 0xe545, 0x464e, 0x464e, 0x664e, 0x464e,
+  0x664e, 0x2434, 0x4111, 0x2109, 0xa21a, 0x664e, 0x664e, 0x8434, 0x8012, 0x0000, 0x000f, 0x2000,
+  0x6000, 0xc108, 0x0111, 0xe108, 0x6000, 0x8000, 0x4109, 0x021a, 0xe322, 0xc42b, 0x4434, 0x664e,
+  0xa64e, 0xa64e, 0x8003, 0xc64e, 0x0017, 0xa64e, 0x864e, 0x264e, 0x664e, 0x864e, 0x464e, 0x0546,
+  0x8545, 0xe53c, 0x4434, 0x8434, 0x6434, 0x442b, 0xe42b, 0x642b, 0x021a, 0xe108, 0xc108, 0xc108,
+  0xe108, 0xc108, 0xa008, 0x4000, 0x8016, 0x0000, 0x0009, 0xa008, 0x4109, 0x4000, 0x0000, 0x0000,
+  0xc108, 0xc211, 0x0109, 0x4000, 0x8003, 0x0000, 0x0010, 0xc008, 0xc322, 0x653d, 0x264e, 0x464e,
+  0x464e, 0x264e, 0x464e, 0x454e, 0x464e, 0x464e, 0x253d, 0x621a, 0x0109, 0x4111, 0xa008, 0x800a,
+  0x0000, 0x0003, 0xa008, 0x2109, 0xe53c, 0x8003, 0x464e, 0x000a, 0x664e, 0x664e, 0x2434, 0x4111,
+  0xa108, 0x8211, 0x6545, 0x664e, 0x664e, 0x021a, 0x800f, 0x0000, 0x000b, 0x8000, 0x4111, 0x0109,
+  0x8008, 0xa108, 0x4111, 0xe211, 0x632b, 0xe53c, 0xe645, 0x664e, 0x8004, 0xa64e, 0x8003, 0xc64e,
+  0x000b, 0xe64e, 0xc64e, 0xa64e, 0x664e, 0x421a, 0xa008, 0x4109, 0x8111, 0x0109, 0xa008, 0x4000,
+  0x8004, 0x0000, 0x0006, 0xa108, 0xe108, 0x6000, 0x0000, 0x0000, 0x2000, 0x8016, 0x0000, 0x0001,
+  0xa008, 0x8006, 0x0000, 0x0003, 0x6000, 0x8000, 0x6000, 0x8009, 0x0000, 0x0010, 0xe108, 0x6434,
+  0x0646, 0x254e, 0x464e, 0x664e, 0x664e, 0x464e, 0x464e, 0xe545, 0x264e, 0xc53c, 0xc111, 0x2109,
+  0x4111, 0x2000, 0x8007, 0x0000, 0x0003, 0x0109, 0x4111, 0x232b, 0x8004, 0x464e, 0x000a, 0x664e,
+  0x6434, 0x8000, 0xa108, 0x4111, 0xc42b, 0x664e, 0x664e, 0x064e, 0xa008, 0x800e, 0x0000, 0x0007,
+  0xc108, 0x4111, 0x8000, 0xc008, 0x421a, 0xa53c, 0x264e, 0x8003, 0x864e, 0x8003, 0xa64e, 0x000b,
+  0xc64e, 0x864e, 0xe545, 0x053d, 0x0646, 0xe756, 0xe64e, 0xe756, 0xc74e, 0x4646, 0xc008, 0x8026,
+  0x0000, 0x0002, 0xa008, 0x2000, 0x8007, 0x0000, 0x0003, 0xa000, 0x8111, 0x8000, 0x8008, 0x0000,
+  0x0010, 0x6000, 0x4323, 0xa545, 0x264e, 0x464e, 0x464e, 0x454e, 0x464e, 0x6645, 0xe53c, 0x6545,
+  0x264e, 0xe433, 0x4111, 0x0109, 0x6000, 0x8004, 0x0000, 0x0006, 0xa008, 0x8211, 0x0109, 0x621a,
+  0x264e, 0x464e, 0x8003, 0x264e, 0x000a, 0x253d, 0xe108, 0xa008, 0x0000, 0x8111, 0x264e, 0x664e,
+  0x664e, 0x8545, 0x4000, 0x8009, 0x0000, 0x0001, 0x2000, 0x8003, 0x0000, 0x0006, 0x6000, 0x6111,
+  0x8222, 0x8434, 0xc645, 0x664e, 0x8005, 0x864e, 0x000e, 0xe645, 0x053d, 0xa32b, 0x421a, 0x0109,
+  0x6000, 0x0000, 0x221a, 0xc74e, 0xe756, 0xe74e, 0xe756, 0x0646, 0x6000, 0x8008, 0x0000, 0x0002,
+  0x4000, 0x2000, 0x8028, 0x0000, 0x0001, 0x2000, 0x8006, 0x0000, 0x0012, 0x2000, 0x8008, 0x2000,
+  0x2109, 0x8434, 0x264e, 0x0546, 0x464e, 0x464e, 0x264e, 0xc545, 0xc53c, 0xa53c, 0xe545, 0xa545,
+  0x8434, 0x432b, 0x2109, 0x8003, 0x0000, 0x0012, 0x6000, 0x2111, 0xc111, 0xe545, 0x454e, 0x464e,
+  0x264e, 0x264e, 0xa545, 0x4111, 0x8000, 0x2000, 0x0000, 0xe322, 0x864e, 0x664e, 0x664e, 0xe42b,
+  0x8009, 0x0000, 0x0012, 0x2000, 0x4000, 0x2000, 0xc008, 0xc322, 0x4434, 0xc545, 0x264e, 0x264e,
+  0x064e, 0x464e, 0x464e, 0xe645, 0xc32b, 0x421a, 0x2109, 0x6000, 0x2000, 0x8005, 0x0000, 0x0007,
+  0x4000, 0xa645, 0x674e, 0x6645, 0x464e, 0xc53c, 0x4000, 0x803a, 0x0000, 0x0008, 0x4000, 0x0109,
+  0x4000, 0x2000, 0xe322, 0xe545, 0x454e, 0x464e, 0x8003, 0x664e, 0x001b, 0xc545, 0x253d, 0xc545,
+  0x464e, 0x0546, 0x0434, 0x8111, 0xc108, 0x6000, 0x8211, 0xe211, 0xc545, 0x464e, 0x454e, 0x464e,
+  0x264e, 0x264e, 0x421a, 0x4000, 0x2000, 0x0000, 0x4000, 0x253d, 0x664e, 0x664e, 0x464e, 0x4111,
+  0x800b, 0x0000, 0x000b, 0x621a, 0x453d, 0x053d, 0xc43c, 0x6434, 0xe42b, 0xc322, 0x6111, 0xa111,
+  0x221a, 0xc008, 0x800a, 0x0000, 0x000a, 0x0109, 0xe74d, 0x285f, 0x6756, 0xe856, 0x674e, 0x053d,
+  0x4434, 0xe211, 0x2000, 0x8039, 0x0000, 0x0007, 0x6000, 0x8008, 0x2000, 0x0109, 0x8434, 0x464e,
+  0x464e, 0x8003, 0x664e, 0x000a, 0x464e, 0x264e, 0x0646, 0x464e, 0x664e, 0x264e, 0x2434, 0xa322,
+  0xe219, 0xa545, 0x8003, 0x464e, 0x000d, 0x264e, 0xe645, 0xa42b, 0x6000, 0x2000, 0x0000, 0x0000,
+  0x6111, 0x464e, 0x664e, 0x664e, 0x4545, 0x4000, 0x800b, 0x0000, 0x0002, 0x4000, 0x6000, 0x8003,
+  0x2000, 0x800e, 0x0000, 0x000c, 0xc211, 0xe42b, 0x053d, 0x0857, 0x485f, 0x285f, 0x285f, 0x0757,
+  0x0757, 0xe756, 0xa74e, 0x4323, 0x801e, 0x0000, 0x0002, 0x2000, 0x2000, 0x8009, 0x0000, 0x0002,
+  0xc008, 0x2000, 0x800f, 0x0000, 0x0012, 0x2000, 0xc108, 0x8000, 0x6000, 0xc322, 0x6545, 0x054e,
+  0xa545, 0x464e, 0x664e, 0x464e, 0x454e, 0x464e, 0x464e, 0x664e, 0x664e, 0xa545, 0xa545, 0x8003,
+  0x464e, 0x0005, 0x264e, 0xa645, 0x642b, 0x8000, 0x2000, 0x8003, 0x0000, 0x0005, 0x4323, 0x464e,
+  0x664e, 0x664e, 0xe433, 0x8006, 0x0000, 0x0001, 0x0100, 0x8017, 0x0000, 0x000e, 0xe211, 0x464e,
+  0xc756, 0xc756, 0x2857, 0x285f, 0x285f, 0x085f, 0xe756, 0xc756, 0xe756, 0xc756, 0xc645, 0x8000,
+  0x8028, 0x0000, 0x0002, 0x2109, 0x4000, 0x8011, 0x0000, 0x000d, 0x8000, 0xc108, 0x0000, 0x0109,
+  0x832b, 0xc42b, 0xe433, 0x453d, 0x464e, 0x464e, 0x664e, 0x464e, 0x464e, 0x8004, 0x664e, 0x0005,
+  0x464e, 0x464e, 0x064e, 0x2434, 0x8000, 0x8004, 0x0000, 0x0006, 0x2000, 0xe53c, 0x464e, 0x264e,
+  0x464e, 0x221a, 0x8006, 0x0000, 0x0002, 0x0208, 0x0100, 0x8016, 0x0000, 0x000e, 0xc322, 0xa74e,
+  0xe756, 0xe756, 0x285f, 0x0857, 0x0857, 0xc756, 0x864e, 0xa64e, 0xe756, 0xc756, 0x464e, 0x6111,
+  0x802e, 0x0000, 0x0002, 0xa211, 0x2000, 0x800e, 0x0000, 0x0008, 0x2000, 0x4000, 0x4109, 0x432b,
+  0x621a, 0xe42b, 0x264e, 0x464e, 0x8005, 0x664e, 0x0005, 0x464e, 0x464e, 0x264e, 0x053d, 0xe108,
+  0x8005, 0x0000, 0x0006, 0x8000, 0x064e, 0x264e, 0x264e, 0x064e, 0xe108, 0x801e, 0x0000, 0x0004,
+  0xc322, 0xc756, 0xe756, 0xe756, 0x8003, 0x0757, 0x0007, 0xe756, 0xa74e, 0x464e, 0x874e, 0x874e,
+  0xc534, 0xa31a, 0x802e, 0x0000, 0x0001, 0x0109, 0x8011, 0x0000, 0x0006, 0x2000, 0xa108, 0x221a,
+  0xc211, 0xe322, 0x064e, 0x8005, 0x664e, 0x0004, 0x464e, 0x264e, 0x6545, 0x2111, 0x8006, 0x0000,
+  0x0006, 0x0109, 0x464e, 0x264e, 0x464e, 0xa645, 0x6000, 0x801b, 0x0000, 0x0011, 0x6000, 0xc211,
+  0xc42b, 0xa545, 0xc656, 0xc64e, 0xc64e, 0xc756, 0xe756, 0xe756, 0x0757, 0xc756, 0xa645, 0xc645,
+  0x6756, 0x2423, 0x4109, 0x8043, 0x0000, 0x0003, 0xc211, 0xc53c, 0xe64d, 0x8005, 0x664e, 0x0005,
+  0x464e, 0xc545, 0x8111, 0x6000, 0x2000, 0x8005, 0x0000, 0x0006, 0xa111, 0x464e, 0x0646, 0xc545,
+  0x253d, 0x2000, 0x8018, 0x0000, 0x0004, 0x2000, 0x4111, 0x832b, 0xc545, 0x8003, 0x864e, 0x000c,
+  0xa64e, 0xa64e, 0xc64e, 0xc656, 0xc756, 0xe756, 0x0757, 0xe756, 0x664e, 0x874e, 0x0857, 0x0323,
+  0x800f, 0x0000, 0x0001, 0x2000, 0x8017, 0x0000, 0x0001, 0x2410, 0x801c, 0x0000, 0x0004, 0xc008,
+  0xc53c, 0x464e, 0x464e, 0x8005, 0x664e, 0x0002, 0xc545, 0x6111, 0x8006, 0x0000, 0x0009, 0x2000,
+  0x2434, 0x464e, 0x264e, 0xc645, 0x6545, 0xc211, 0xc108, 0x4000, 0x8014, 0x0000, 0x0004, 0x8000,
+  0x6111, 0x842b, 0xc545, 0x8004, 0x864e, 0x000e, 0x664e, 0xa64e, 0xa64e, 0xc64e, 0xe74e, 0xc756,
+  0xc74e, 0xe74e, 0xc756, 0xa64e, 0xc756, 0x0857, 0xe53c, 0x4000, 0x800d, 0x0000, 0x0002, 0x2000,
+  0x2000, 0x8020, 0x0000, 0x0005, 0x4109, 0x2212, 0x0000, 0x0000, 0x0100, 0x800f, 0x0000, 0x0002,
+  0x2000, 0x0323, 0x8008, 0x664e, 0x0003, 0x064e, 0x621a, 0x2000, 0x8004, 0x0000, 0x000d, 0xa211,
+  0x264e, 0x664e, 0x064e, 0x8545, 0xc645, 0x453d, 0x253d, 0x842b, 0x621a, 0xc108, 0x2000, 0x2000,
+  0x8008, 0x0000, 0x000a, 0x2000, 0x6000, 0x6000, 0x8108, 0x0111, 0x4211, 0x6111, 0xa32b, 0xc545,
+  0x664e, 0x8003, 0x864e, 0x8003, 0xa64e, 0x0007, 0x864e, 0xc64e, 0xc64e, 0xc74e, 0xe74e, 0xc64e,
+  0xc74e, 0x8003, 0xc64e, 0x0004, 0xe756, 0x2857, 0xe53c, 0xa108, 0x802f, 0x0000, 0x0002, 0x6000,
+  0x6000, 0x8011, 0x0000, 0x0003, 0x4000, 0x8322, 0xe64d, 0x8005, 0x664e, 0x0007, 0x464e, 0x664e,
+  0x464e, 0x664e, 0x664e, 0xe433, 0x6000, 0x8003, 0x0000, 0x001c, 0x2323, 0x464e, 0x464e, 0x264e,
+  0x264e, 0x064e, 0x8545, 0xa534, 0x453d, 0x264e, 0x8545, 0xc43c, 0xa53c, 0xa322, 0x8111, 0x0109,
+  0xc108, 0x6000, 0xa108, 0x2000, 0x4000, 0xc108, 0x2109, 0x6111, 0xa322, 0x4434, 0xa545, 0x454e,
+  0x8005, 0x864e, 0x8005, 0xa64e, 0x000d, 0xc656, 0xc756, 0xe756, 0xe64e, 0xc756, 0xe756, 0xe656,
+  0xe756, 0xc656, 0xe756, 0x0757, 0x6645, 0x8108, 0x8041, 0x0000, 0x0003, 0x2000, 0xe219, 0x6545,
+  0x8005, 0x664e, 0x0017, 0x464e, 0x464e, 0x664e, 0x664e, 0x464e, 0x664e, 0x464e, 0xa43c, 0xa000,
+  0x0000, 0x0000, 0x6111, 0x4434, 0xa545, 0xe645, 0xc645, 0xe645, 0xe645, 0x2434, 0x2323, 0x253d,
+  0x264e, 0x464e, 0x8003, 0x264e, 0x0009, 0x064e, 0xa545, 0xc53c, 0x232b, 0xa322, 0x0323, 0xc32b,
+  0x4545, 0x064e, 0x8003, 0x664e, 0x8008, 0x864e, 0x0010, 0x464e, 0x8545, 0x4434, 0x453d, 0xc756,
+  0xc756, 0xc64e, 0xc64e, 0xa64e, 0xc64e, 0xc64e, 0x864e, 0xa74e, 0x0757, 0x274e, 0x6000, 0x8007,
+  0x0000, 0x0001, 0x2000, 0x8038, 0x0000, 0x0003, 0x2000, 0x0109, 0x8434, 0x8004, 0x664e, 0x0013,
+  0x464e, 0x6545, 0x253d, 0xe645, 0xa545, 0x664e, 0x464e, 0x064e, 0x464e, 0x264e, 0x4434, 0x6000,
+  0x0000, 0x0000, 0x2000, 0xc008, 0xa111, 0xc42b, 0xa645, 0x8003, 0x264e, 0x0001, 0x464e, 0x800a,
+  0x664e, 0x0002, 0x864e, 0x664e, 0x8003, 0x464e, 0x8004, 0x664e, 0x0016, 0x264e, 0x664e, 0xc545,
+  0xc43c, 0x632b, 0xc111, 0xc108, 0x4000, 0x0000, 0x2109, 0x264e, 0xc756, 0xc756, 0xe756, 0xa64e,
+  0x664e, 0xc534, 0xa645, 0x674e, 0x0757, 0xc756, 0x0109, 0x800f, 0x0000, 0x0001, 0xe108, 0x8024,
+  0x0000, 0x0001, 0x2410, 0x800b, 0x0000, 0x0014, 0x2000, 0xa322, 0x464e, 0x664e, 0x464e, 0x264e,
+  0x664e, 0x453d, 0x0109, 0x8000, 0x843c, 0xc645, 0xe645, 0x464e, 0x464e, 0x664e, 0x464e, 0xc645,
+  0xe322, 0x6000, 0x8004, 0x0000, 0x0005, 0xa211, 0xa42b, 0xa53c, 0x4545, 0xc545, 0x8003, 0x664e,
+  0x8004, 0x864e, 0x0003, 0x664e, 0x664e, 0x864e, 0x8003, 0x664e, 0x000d, 0x464e, 0x264e, 0x064e,
+  0x264e, 0x264e, 0x464e, 0xc545, 0x0434, 0x621a, 0xc008, 0xa008, 0xa108, 0x8008, 0x8004, 0x0000,
+  0x000c, 0x442b, 0xc74e, 0xa64e, 0xe756, 0xe756, 0xa756, 0xa53c, 0x2646, 0xe756, 0xe756, 0x874e,
+  0xe108, 0x800f, 0x0000, 0x0001, 0x6000, 0x8024, 0x0000, 0x0001, 0x0208, 0x800b, 0x0000, 0x0002,
+  0x0323, 0x264e, 0x8005, 0x664e, 0x0008, 0x054e, 0x843c, 0x432b, 0x421a, 0x4545, 0x664e, 0x464e,
+  0x464e, 0x8003, 0x664e, 0x0002, 0xc645, 0xe219, 0x8004, 0x0000, 0x8003, 0x2000, 0x0004, 0x4000,
+  0xc108, 0xe322, 0x453d, 0x8007, 0x664e, 0x0003, 0x864e, 0x664e, 0x664e, 0x8004, 0x464e, 0x0009,
+  0xa545, 0x6434, 0xa21a, 0xe108, 0xa008, 0xe108, 0x2111, 0xc108, 0x2000, 0x8005, 0x0000, 0x000c,
+  0xe108, 0x674e, 0x0757, 0x285f, 0x2857, 0x285f, 0x285f, 0x0757, 0x674e, 0xe645, 0x832b, 0x2000,
+  0x803f, 0x0000, 0x0004, 0x221a, 0x064e, 0x264e, 0x464e, 0x8005, 0x664e, 0x0008, 0x464e, 0x264e,
+  0x464e, 0x264e, 0x664e, 0x664e, 0x464e, 0x464e, 0x8003, 0x664e, 0x0002, 0x053d, 0xe108, 0x8009,
+  0x0000, 0x0004, 0xc108, 0x0434, 0xe545, 0x464e, 0x8006, 0x664e, 0x000b, 0x464e, 0x464e, 0x264e,
+  0x253d, 0xa222, 0xa008, 0x4000, 0x8108, 0xc108, 0x8008, 0x2000, 0x8008, 0x0000, 0x000a, 0x2000,
+  0xc53c, 0x285f, 0x085f, 0xc856, 0x074e, 0xe53c, 0xe322, 0x2109, 0xa000, 0x8040, 0x0000, 0x000c,
+  0x4000, 0x642b, 0x832b, 0x253d, 0x464e, 0x264e, 0x664e, 0x464e, 0x464e, 0x264e, 0x264e, 0x464e,
+  0x8004, 0x664e, 0x8003, 0x464e, 0x0005, 0x264e, 0x664e, 0x664e, 0x053d, 0x6000, 0x8009, 0x0000,
+  0x0010, 0x6000, 0x6434, 0x464e, 0x664e, 0x664e, 0x464e, 0x464e, 0x664e, 0x464e, 0x6545, 0x432b,
+  0x2109, 0x8000, 0x8000, 0x4000, 0x2000, 0x800d, 0x0000, 0x0005, 0xa008, 0xa322, 0x6111, 0xc108,
+  0x4000, 0x8027, 0x0000, 0x0001, 0x2208, 0x800e, 0x0000, 0x0003, 0x0208, 0xb150, 0x6b30, 0x800a,
+  0x0000, 0x0011, 0x4518, 0x0000, 0x4000, 0xe108, 0xc43c, 0x464e, 0x264e, 0x264e, 0xe545, 0x0646,
+  0x064e, 0x264e, 0xa545, 0x8545, 0xc645, 0xe645, 0x464e, 0x8006, 0x664e, 0x0002, 0x464e, 0xc322,
+  0x8009, 0x0000, 0x000c, 0x2323, 0x464e, 0x464e, 0x664e, 0x464e, 0x264e, 0x464e, 0x6545, 0x2434,
+  0xe108, 0x2000, 0x2000, 0x804c, 0x0000, 0x0003, 0x2208, 0xd358, 0x6b30, 0x8005, 0x0000, 0x0001,
+  0x2410, 0x8008, 0x0000, 0x000f, 0x8000, 0xc111, 0x8111, 0xa222, 0x0323, 0xa534, 0xa645, 0xc645,
+  0xe545, 0xc645, 0x8645, 0x4645, 0x253d, 0xc64d, 0x464e, 0x8005, 0x664e, 0x0002, 0xc545, 0x8000,
+  0x8007, 0x0000, 0x000a, 0x421a, 0x254e, 0x464e, 0x664e, 0x664e, 0x464e, 0x4545, 0x221a, 0xc108,
+  0x4000, 0x8023, 0x0000, 0x0002, 0x4000, 0x4000, 0x8022, 0x0000, 0x0002, 0x2208, 0x0100, 0x801c,
+  0x0000, 0x000a, 0x2000, 0xe108, 0x0323, 0x6534, 0x4534, 0xa53c, 0xe64d, 0xc645, 0x2645, 0x6545,
+  0x8005, 0x464e, 0x0002, 0x8545, 0x8000, 0x8006, 0x0000, 0x0002, 0x4111, 0xc545, 0x8003, 0x464e,
+  0x0004, 0x264e, 0xc53c, 0xa42b, 0x6000, 0x8063, 0x0000, 0x0004, 0x2000, 0x6000, 0x6000, 0x2000,
+  0x8003, 0x0000, 0x000d, 0x2000, 0x2000, 0x6000, 0x6111, 0x221a, 0xc322, 0x4323, 0x4434, 0x264e,
+  0x464e, 0x264e, 0x264e, 0x832b, 0x8006, 0x0000, 0x0002, 0xc108, 0xc53c, 0x8004, 0x464e, 0x0003,
+  0x264e, 0xe53c, 0xe108, 0x8024, 0x0000, 0x0001, 0x4000, 0x803d, 0x0000, 0x0008, 0x4111, 0xc108,
+  0x8008, 0xa211, 0xc211, 0x6000, 0x4000, 0x2000, 0x8005, 0x0000, 0x0009, 0x2000, 0x6000, 0xe219,
+  0x2434, 0xa645, 0x464e, 0x264e, 0xa545, 0xc008, 0x8005, 0x0000, 0x0002, 0x8000, 0x8434, 0x8004,
+  0x464e, 0x0003, 0x264e, 0x253d, 0x4111, 0x8010, 0x0000, 0x0001, 0x4000, 0x8013, 0x0000, 0x0001,
+  0x2000, 0x803c, 0x0000, 0x000a, 0x2000, 0xe108, 0xa108, 0x8111, 0xa42b, 0x4434, 0xa322, 0x221a,
+  0xe322, 0xe108, 0x8006, 0x0000, 0x0007, 0x8000, 0xa53c, 0x6545, 0x8645, 0x264e, 0x464e, 0xe42b,
+  0x8005, 0x0000, 0x0009, 0x2000, 0x0434, 0x064e, 0x264e, 0x464e, 0x064e, 0x264e, 0x6545, 0x4111,
+  0x8025, 0x0000, 0x0001, 0x4000, 0x801c, 0x0000, 0x0001, 0x0100, 0x801d, 0x0000, 0x000b, 0x2000,
+  0x0109, 0x6211, 0xa211, 0x4434, 0x6545, 0xe645, 0x8534, 0x2434, 0x4323, 0xa008, 0x8007, 0x0000,
+  0x0007, 0x421a, 0x064e, 0xc645, 0xe645, 0x264e, 0x264e, 0xe211, 0x8004, 0x0000, 0x0009, 0x4000,
+  0xc32b, 0xc545, 0x853c, 0x264e, 0x0646, 0x064e, 0x6545, 0x6111, 0x801a, 0x0000, 0x0001, 0x2208,
+  0x8028, 0x0000, 0x0001, 0x0100, 0x801c, 0x0000, 0x000b, 0x8000, 0xa008, 0xa008, 0x621a, 0x6545,
+  0x0646, 0xa645, 0xe53c, 0xa545, 0x432b, 0x8000, 0x8007, 0x0000, 0x0002, 0x2000, 0x8434, 0x8004,
+  0x064e, 0x0002, 0xc53c, 0x4000, 0x8004, 0x0000, 0x0008, 0x632b, 0xe645, 0xc42b, 0xc645, 0xc53c,
+  0x6545, 0xc545, 0x6111, 0x805f, 0x0000, 0x000d, 0x6000, 0x2109, 0xa008, 0xe211, 0xe53c, 0x064e,
+  0x253d, 0x653d, 0x464e, 0xe53c, 0x221a, 0x0109, 0x2000, 0x8006, 0x0000, 0x0008, 0x2000, 0xe108,
+  0xe64d, 0x464e, 0x264e, 0x064e, 0xc645, 0x221a, 0x8004, 0x0000, 0x0008, 0xe211, 0x0646, 0x4434,
+  0x4545, 0x0434, 0xc433, 0xe64d, 0xc211, 0x805e, 0x0000, 0x000e, 0x8000, 0xe108, 0xc108, 0xe211,
+  0x053d, 0x064e, 0xc53c, 0xe53c, 0xc545, 0xa545, 0xe322, 0xa008, 0xa008, 0x6000, 0x8006, 0x0000,
+  0x0003, 0x2000, 0xc211, 0xe322, 0x8004, 0x464e, 0x0002, 0x8545, 0x6000, 0x8003, 0x0000, 0x0008,
+  0xa008, 0x6545, 0x4545, 0x253d, 0x2434, 0xa32b, 0xe64d, 0x621a, 0x805d, 0x0000, 0x000e, 0xa108,
+  0xe108, 0xe108, 0x8111, 0x2434, 0xc645, 0xc545, 0xc545, 0x8545, 0xe645, 0xa32b, 0xc008, 0x4000,
+  0x8000, 0x8008, 0x0000, 0x0013, 0x4000, 0xa008, 0x653c, 0x464e, 0x064e, 0x264e, 0x264e, 0xc53c,
+  0x2000, 0x0000, 0x0000, 0x6000, 0x8434, 0x264e, 0xc645, 0x4545, 0xa42b, 0xe645, 0x421a, 0x805c,
+  0x0000, 0x000f, 0x4000, 0x8000, 0x4111, 0xe219, 0x4434, 0x0646, 0x264e, 0xa545, 0xc545, 0x0646,
+  0x053d, 0xa111, 0x6000, 0x8108, 0x2000, 0x8009, 0x0000, 0x0012, 0x4000, 0x8111, 0xa645, 0x664e,
+  0xc53c, 0xc645, 0x264e, 0xc42b, 0x0000, 0x0000, 0x2000, 0xe42b, 0x464e, 0x064e, 0x264e, 0x6545,
+  0xe64d, 0x432b, 0x805c, 0x0000, 0x000e, 0x0109, 0x421a, 0x8111, 0xc42b, 0x054e, 0x254e, 0x264e,
+  0x464e, 0x264e, 0x253d, 0x2434, 0xa42b, 0xc211, 0x8000, 0x800a, 0x0000, 0x000c, 0x4000, 0x6000,
+  0x842b, 0x464e, 0x664e, 0x4434, 0x264e, 0x464e, 0x021a, 0x0000, 0x0000, 0x0323, 0x8004, 0x264e,
+  0x0003, 0x4545, 0xe219, 0x2000, 0x8003, 0x0000, 0x0001, 0x0100, 0x8014, 0x0000, 0x0002, 0x0100,
+  0x2308, 0x8036, 0x0000, 0x0004, 0x4000, 0x0000, 0x0000, 0x2000, 0x8006, 0x0000, 0x0005, 0x2000,
+  0x0109, 0x621a, 0x821a, 0x253d, 0x8004, 0x464e, 0x0006, 0x064e, 0xc53c, 0x632b, 0x2423, 0x4111,
+  0x2000, 0x800b, 0x0000, 0x000c, 0x8000, 0xe108, 0x6545, 0x664e, 0x054e, 0xe53c, 0x464e, 0xa545,
+  0x8000, 0x0000, 0xe219, 0x064e, 0x8003, 0x464e, 0x0003, 0x064e, 0xe42b, 0x2000, 0x8004, 0x0000,
+  0x0002, 0x4518, 0x2208, 0x8013, 0x0000, 0x0001, 0x0108, 0x8036, 0x0000, 0x0005, 0x4000, 0x2000,
+  0x0000, 0x0000, 0x4000, 0x8005, 0x0000, 0x000e, 0x2111, 0x842b, 0x632b, 0x6434, 0x254e, 0x454e,
+  0x0546, 0x254e, 0x454e, 0x254e, 0xa545, 0x2323, 0xe108, 0x4000, 0x800d, 0x0000, 0x000b, 0xa108,
+  0xe322, 0x664e, 0x664e, 0x064e, 0xe64d, 0x664e, 0x2434, 0x0000, 0x6111, 0xc545, 0x8003, 0x464e,
+  0x0003, 0x264e, 0x843c, 0xe108, 0x8003, 0x0000, 0x0004, 0x0108, 0x6828, 0x8c38, 0x8b38, 0x804b,
+  0x0000, 0x0002, 0x4000, 0x6000, 0x8005, 0x0000, 0x000e, 0x2000, 0x8211, 0x442b, 0xa545, 0x454e,
+  0x464e, 0x464e, 0x264e, 0x2546, 0x464e, 0x054e, 0x6434, 0xc111, 0x2000, 0x800e, 0x0000, 0x0011,
+  0x6000, 0x8211, 0x453d, 0x664e, 0x664e, 0x264e, 0x664e, 0x664e, 0x021a, 0x0109, 0x8545, 0x464e,
+  0x264e, 0x264e, 0x064e, 0x653d, 0x2109, 0x8005, 0x0000, 0x0005, 0xaf40, 0xf668, 0x1771, 0x6a30,
+  0x0100, 0x8046, 0x0000, 0x0004, 0x2000, 0x0000, 0xc108, 0x0109, 0x8004, 0x0000, 0x000e, 0x2000,
+  0x2109, 0xc42b, 0x8545, 0x064e, 0x264e, 0xc545, 0xa545, 0x264e, 0x264e, 0x6545, 0xe53c, 0x421a,
+  0x4000, 0x800a, 0x0000, 0x0001, 0x6a30, 0x8005, 0x0000, 0x0010, 0xc108, 0xc42b, 0x464e, 0x664e,
+  0x464e, 0x464e, 0x664e, 0xe64d, 0x8111, 0xe53c, 0x464e, 0x464e, 0xe645, 0x8645, 0xc433, 0x2109,
+  0x8005, 0x0000, 0x0007, 0x2208, 0xae48, 0xf870, 0xf768, 0xf668, 0x4618, 0x2308, 0x8043, 0x0000,
+  0x0005, 0x2000, 0x2000, 0x0000, 0x4000, 0x2000, 0x8004, 0x0000, 0x000d, 0x8108, 0x831a, 0xc43c,
+  0x0546, 0x053d, 0x0434, 0x253d, 0x0646, 0x264e, 0x8545, 0xa42b, 0x8111, 0x6000, 0x800c, 0x0000,
+  0x0001, 0xa410, 0x8004, 0x0000, 0x0005, 0x4000, 0x2111, 0x6545, 0x664e, 0x464e, 0x8003, 0x664e,
+  0x0008, 0xa545, 0x843c, 0x464e, 0x464e, 0x264e, 0xe64d, 0x642b, 0x8000, 0x8007, 0x0000, 0x0007,
+  0x6828, 0x8e40, 0xf870, 0xf870, 0xf568, 0x6a30, 0x2108, 0x800b, 0x0000, 0x0001, 0x8000, 0x800f,
+  0x0000, 0x0002, 0x0100, 0x0208, 0x8020, 0x0000, 0x0001, 0x2000, 0x8004, 0x0000, 0x0002, 0x0109,
+  0x2000, 0x8004, 0x0000, 0x000e, 0xa000, 0x2109, 0xa211, 0x442b, 0x453d, 0x6434, 0x021a, 0x4111,
+  0xa42b, 0xe545, 0xc43c, 0x6434, 0x632b, 0x0109, 0x800e, 0x0000, 0x0001, 0x4000, 0x8004, 0x0000,
+  0x0003, 0x8000, 0xe219, 0x464e, 0x8007, 0x664e, 0x0005, 0x464e, 0x264e, 0x264e, 0xe53c, 0xe108,
+  0x8009, 0x0000, 0x0006, 0x2208, 0xae40, 0xf870, 0xf870, 0xf668, 0x6b30, 0x800a, 0x0000, 0x0002,
+  0x2000, 0x0109, 0x803b, 0x0000, 0x000d, 0x2000, 0x0109, 0xa211, 0x421a, 0xe433, 0xa21a, 0x4111,
+  0xe322, 0x653d, 0xe645, 0xe545, 0x632b, 0x2109, 0x800b, 0x0000, 0x0001, 0x2000, 0x8009, 0x0000,
+  0x0002, 0x4000, 0x0434, 0x8007, 0x664e, 0x8003, 0x464e, 0x0002, 0xc545, 0xc211, 0x800b, 0x0000,
+  0x0006, 0x4518, 0x6a30, 0xf668, 0xf770, 0xf668, 0x6928, 0x8046, 0x0000, 0x000c, 0xe108, 0x642b,
+  0x831a, 0x221a, 0xa111, 0xe42b, 0x653d, 0x264e, 0x6545, 0xc322, 0x4111, 0x2000, 0x800c, 0x0000,
+  0x0001, 0x4000, 0x8009, 0x0000, 0x0002, 0x8000, 0xc645, 0x8004, 0x464e, 0x8003, 0x664e, 0x0006,
+  0x454e, 0x464e, 0x464e, 0xc222, 0x0000, 0x4000, 0x800b, 0x0000, 0x0006, 0x4518, 0x6820, 0xd358,
+  0xf768, 0xf770, 0x4828, 0x8044, 0x0000, 0x000a, 0xa008, 0x421a, 0xe219, 0x6000, 0x6111, 0x253d,
+  0x2546, 0x0646, 0x2434, 0xe108, 0x8008, 0x0000, 0x0001, 0x6000, 0x8010, 0x0000, 0x000f, 0x021a,
+  0x064e, 0x264e, 0x464e, 0x264e, 0x464e, 0x664e, 0x464e, 0x464e, 0x264e, 0x464e, 0xa32b, 0x2000,
+  0x8008, 0x4000, 0x800c, 0x0000, 0x0006, 0x2310, 0x4720, 0xd150, 0xd560, 0xf668, 0x4720, 0x8003,
+  0x0000, 0x0002, 0x2310, 0x6828, 0x803d, 0x0000, 0x000a, 0xa211, 0x8111, 0x2000, 0x6000, 0xa21a,
+  0xc545, 0x464e, 0x653d, 0x4323, 0x0109, 0x8008, 0x0000, 0x0002, 0xa000, 0x4323, 0x800f, 0x0000,
+  0x0006, 0x2000, 0xc433, 0xc53c, 0x064e, 0x464e, 0x264e, 0x8004, 0x464e, 0x0005, 0x264e, 0x2434,
+  0x4000, 0xa008, 0xc108, 0x800e, 0x0000, 0x000a, 0x0208, 0x6828, 0x8b30, 0xb048, 0xf568, 0x4518,
+  0x0000, 0x0000, 0x4618, 0x6928, 0x803b, 0x0000, 0x000b, 0x2000, 0xe108, 0x6000, 0x0000, 0x0109,
+  0x8434, 0xe545, 0x653d, 0x4323, 0xc211, 0x4000, 0x800a, 0x0000, 0x0001, 0x4000, 0x8008, 0x0000,
+  0x0001, 0x2208, 0x8006, 0x0000, 0x0006, 0x2000, 0xc42b, 0xa53c, 0x464e, 0x264e, 0x464e, 0x8004,
+  0x264e, 0x0004, 0x053d, 0xa008, 0x6000, 0x6111, 0x8010, 0x0000, 0x0008, 0x0100, 0x8d40, 0x8e40,
+  0xd258, 0xf560, 0x2410, 0x0100, 0x0108, 0x800d, 0x0000, 0x0004, 0x2208, 0x2310, 0x4720, 0x0108,
+  0x802a, 0x0000, 0x000a, 0x4000, 0xa108, 0x0000, 0x0000, 0x621a, 0xa545, 0x254e, 0xe43c, 0x021a,
+  0x4000, 0x8010, 0x0000, 0x0001, 0x2308, 0x800b, 0x0000, 0x000d, 0xa008, 0xe433, 0x064e, 0x464e,
+  0x264e, 0x464e, 0x254e, 0x264e, 0x264e, 0x4545, 0x0109, 0x2000, 0x4111, 0x8012, 0x0000, 0x000b,
+  0x0100, 0x8e40, 0xd560, 0xf870, 0xd258, 0xae40, 0x4618, 0x2208, 0x2410, 0x2310, 0x0100, 0x8004,
+  0x0000, 0x000b, 0x0208, 0x4518, 0x6828, 0x6828, 0xaf48, 0xf668, 0xf770, 0xf870, 0xb150, 0x2518,
+  0x2208, 0x8028, 0x0000, 0x0008, 0x4000, 0x0000, 0x8000, 0xa32b, 0xc545, 0xc53c, 0x4323, 0xe108,
+  0x8012, 0x0000, 0x0001, 0x2510, 0x8007, 0x0000, 0x0001, 0xc008, 0x8003, 0x0000, 0x000d, 0xe211,
+  0x8545, 0x264e, 0x4545, 0x264e, 0x464e, 0x264e, 0x264e, 0xc545, 0x4111, 0x0000, 0x8111, 0x2000,
+  0x8013, 0x0000, 0x0002, 0x0100, 0x8e40, 0x8003, 0xf770, 0x0014, 0xd560, 0xd258, 0x6928, 0x4720,
+  0x4820, 0x2410, 0x2208, 0x2518, 0x4620, 0x4620, 0x6828, 0x6b30, 0x8e40, 0xd560, 0xf770, 0xf770,
+  0xf668, 0xd560, 0x8e40, 0x6928, 0x8027, 0x0000, 0x0007, 0x4000, 0x0000, 0x2000, 0x421a, 0x2323,
+  0xa32b, 0xe108, 0x801c, 0x0000, 0x0010, 0x6000, 0x0000, 0x0000, 0x4000, 0xc53c, 0x4545, 0x2545,
+  0x053d, 0x464e, 0x464e, 0x264e, 0x054e, 0x621a, 0x0000, 0x0109, 0x8000, 0x8016, 0x0000, 0x0015,
+  0x8d40, 0xf770, 0xf870, 0xf770, 0xb048, 0x8c38, 0x4720, 0x6928, 0x8b30, 0x6828, 0x6928, 0xb048,
+  0xd568, 0xf770, 0xf770, 0xf870, 0xf870, 0xd560, 0x4620, 0x2310, 0x2308, 0x8028, 0x0000, 0x0007,
+  0x8000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x2000, 0x8004, 0x0000, 0x0001, 0x2000, 0x801b,
+  0x0000, 0x000c, 0x2109, 0x053d, 0x2434, 0x2434, 0xc545, 0x264e, 0xe545, 0x264e, 0x632b, 0x0000,
+  0x6000, 0x8000, 0x8018, 0x0000, 0x0012, 0x4828, 0xf668, 0xd258, 0x8d40, 0xf770, 0xd560, 0xd560,
+  0x8d40, 0x2310, 0xb048, 0xf870, 0xf870, 0xd568, 0xb258, 0x8d40, 0x4828, 0x4820, 0x2208, 0x8033,
+  0x0000, 0x0003, 0x2000, 0x0109, 0x8000, 0x8016, 0x0000, 0x0001, 0x8000, 0x8003, 0x2000, 0x000c,
+  0x0000, 0xa322, 0x432b, 0x8534, 0x853c, 0x264e, 0x453d, 0xe645, 0x8434, 0x4000, 0x4000, 0x6000,
+  0x8019, 0x0000, 0x000e, 0x2310, 0xd668, 0xb050, 0xb050, 0xf770, 0xf978, 0xf870, 0xd358, 0x6a30,
+  0xd358, 0xf770, 0xb258, 0x4618, 0x0108, 0x8037, 0x0000, 0x0001, 0x4000, 0x8018, 0x0000, 0x0001,
+  0x6000, 0x8003, 0x0000, 0x000b, 0x6000, 0x4434, 0x6434, 0xa53c, 0xc645, 0xe53c, 0x6434, 0x6545,
+  0xe108, 0x4000, 0x8008, 0x801a, 0x0000, 0x000c, 0x6a28, 0xf770, 0xf870, 0xf770, 0xf870, 0x1871,
+  0xf870, 0xd668, 0xf768, 0xf770, 0xaf48, 0x0208, 0x8056, 0x0000, 0x000a, 0x2109, 0x6434, 0xe53c,
+  0xe645, 0x8545, 0xc53c, 0xe645, 0xe211, 0x2000, 0xc108, 0x8008, 0x0000, 0x0001, 0x0208, 0x8012,
+  0x0000, 0x0007, 0xb150, 0xf870, 0xf878, 0xf870, 0x1871, 0xf870, 0xf870, 0x8003, 0xf770, 0x0001,
+  0x4518, 0x801d, 0x0000, 0x0001, 0x0100, 0x8039, 0x0000, 0x0009, 0xa211, 0xc211, 0x453d, 0x6545,
+  0xa53c, 0xc545, 0x0323, 0x2000, 0x0109, 0x801c, 0x0000, 0x0005, 0x8d40, 0xf870, 0xf878, 0xf878,
+  0x1871, 0x8003, 0xf870, 0x0002, 0xf770, 0xb150, 0x8058, 0x0000, 0x0008, 0x6000, 0x821a, 0x453d,
+  0xa42b, 0x6545, 0xe322, 0x4000, 0x8000, 0x801d, 0x0000, 0x000a, 0x0108, 0xd560, 0x8e40, 0x6928,
+  0x4620, 0x6b30, 0xd358, 0xd358, 0xf768, 0x6b30, 0x8058, 0x0000, 0x0008, 0x8000, 0xa434, 0xc211,
+  0xc32b, 0x821a, 0x2000, 0x6000, 0x2000, 0x801d, 0x0000, 0x0003, 0x4620, 0xd460, 0x0100, 0x8004,
+  0x0000, 0x0003, 0x0100, 0x8d38, 0x8d38, 0x8058, 0x0000, 0x0006, 0x821a, 0x2323, 0x2323, 0xc222,
+  0x0000, 0x4000, 0x801f, 0x0000, 0x0002, 0xb048, 0x8d40, 0x8006, 0x0000, 0x0002, 0x4518, 0xd358,
+  0x8057, 0x0000, 0x0004, 0x6000, 0xe42b, 0x821a, 0x821a, 0x8003, 0x2000, 0x8004, 0x0000, 0x0001,
+  0x0100, 0x8019, 0x0000, 0x0003, 0x2208, 0xf568, 0x4518, 0x8006, 0x0000, 0x0003, 0x0108, 0xd460,
+  0x2310, 0x8050, 0x0000, 0x0001, 0x2000, 0x8005, 0x0000, 0x0003, 0xe219, 0x221a, 0x621a, 0x8016,
+  0x0000, 0x0002, 0x6820, 0x2518, 0x8008, 0x0000, 0x0005, 0x4820, 0x8e40, 0x8c38, 0xd460, 0x0100,
+  0x8007, 0x0000, 0x0004, 0xb048, 0x8c38, 0x4720, 0x2208, 0x804d, 0x0000, 0x0002, 0x4000, 0x2000,
+  0x8004, 0x0000, 0x0004, 0x8000, 0xa111, 0x0212, 0x2000, 0x8016, 0x0000, 0x0002, 0x4518, 0x2410,
+  0x8007, 0x0000, 0x0005, 0x2310, 0xd460, 0xb150, 0xd460, 0x6b30, 0x8008, 0x0000, 0x0005, 0x6928,
+  0xd768, 0xd460, 0xb150, 0x0100, 0x804c, 0x0000, 0x0001, 0x4000, 0x8005, 0x0000, 0x0003, 0x8111,
+  0x6111, 0x6000, 0x8020, 0x0000, 0x0005, 0x2410, 0xf870, 0xf668, 0xf768, 0x2310, 0x8008, 0x0000,
+  0x0005, 0x2308, 0xd460, 0xd668, 0xf668, 0x0208, 0x8010, 0x0000, 0x0002, 0x6b30, 0x4820, 0x8022,
+  0x0000, 0x0002, 0x2000, 0x4000, 0x8015, 0x0000, 0x0001, 0x4000, 0x8005, 0x0000, 0x0003, 0xe108,
+  0xa211, 0x6000, 0x8021, 0x0000, 0x0005, 0x2308, 0xf668, 0xf870, 0xf568, 0x2208, 0x8008, 0x0000,
+  0x0004, 0x2308, 0xd560, 0xf770, 0xb048, 0x8005, 0x0000, 0x0001, 0x0100, 0x800b, 0x0000, 0x0002,
+  0x0108, 0x2308, 0x803e, 0x0000, 0x0003, 0x4000, 0x0109, 0xc108, 0x8023, 0x0000, 0x0006, 0x4820,
+  0xf768, 0xf970, 0xd460, 0x6928, 0x0100, 0x8005, 0x0000, 0x0005, 0x2410, 0xd250, 0xf870, 0xd668,
+  0x2518, 0x8051, 0x0000, 0x0004, 0xc108, 0x4109, 0xc108, 0x2000, 0x8023, 0x0000, 0x0006, 0x2310,
+  0x8c38, 0xd458, 0xf870, 0xb250, 0x0100, 0x8004, 0x0000, 0x0004, 0x6928, 0xf870, 0xb258, 0x2410,
+  0x8052, 0x0000, 0x0003, 0x6000, 0x6111, 0x4000, 0x8004, 0x0000, 0x0001, 0x2000, 0x8021, 0x0000,
+  0x0003, 0x0100, 0x4618, 0x6928, 0x8005, 0x0000, 0x0003, 0x0208, 0x6928, 0x0108, 0x8053, 0x0000,
+  0x0008, 0x4000, 0x4000, 0x0000, 0x2000, 0x0000, 0x0000, 0x4000, 0x6000, 0x82d4, 0x0000, 0x0001,
+  0x0100, 0x8047, 0x0000, 0x0001, 0x2000, 0x80e9, 0x0000,
+};
+static const unsigned int logo_rle_len = 6427;
@@ -23,140 +23,140 @@
 #include <Arduino.h>
 #include <M5StickCPlus2.h>
 #include <esp_task_wdt.h>  // Include for watchdog timer
-#include <Preferences.h>   // Include for Preferences
 
 #include "Config.h"
 #include "channels/ChannelManager.h"
+#if BLE_GAMEPAD
+#include "controllers/BLEGamepadController.h"
+#else
 #include "controllers/PS5Controller.h"
+#endif
 #include "crsf/CRSFModule.h"
+#include "recorder/FlightRecorder.h"
 #include "display/ScreenManager.h"
 #include "display/StatusScreen.h"
 #include "display/ControllerScreen.h"
 #include "display/LogoScreen.h"
+#if !BLE_GAMEPAD
 #include "display/ConnectionScreen.h"
+#endif
+#include "utils/Log.h"
+#include "utils/AllocCounter.h"
+#include "utils/ConfigStore.h"
+#include "utils/BootTimeline.h"
+#include "utils/DeviceButtons.h"
+#include "utils/PowerManager.h"
+#include "utils/BluetoothLock.h"
+
+#ifdef REPLAY_TRACE
+// Bench mode: build with -DREPLAY_TRACE=\"/trace.csv\" to drive the channel
+// pipeline from a trace on LittleFS instead of a DualSense
+#include "replay/TraceReplaySource.h"
+#include "replay/ReplayEngine.h"
+#if BLE_GAMEPAD
+#error "REPLAY_TRACE drives the DualSense controller, build it without BLE_GAMEPAD"
+#endif
+#endif
 
 // Global objects
 ChannelManager channelManager;
+#if BLE_GAMEPAD
+BLEGamepadController gamepad(&channelManager);
+Controller& inputController = gamepad;
+#else
 PS5Controller ps5Controller(&channelManager);
+Controller& inputController = ps5Controller;
+#endif
 CRSFModule crsfModule(&channelManager);
+FlightRecorder flightRecorder;
 ScreenManager screenManager;
 
-// Connection screen reference for button handling
-ConnectionScreen* connectionScreen = nullptr;
+#ifdef REPLAY_TRACE
+TraceReplaySource replaySource;
+#endif
 
-// Button handling
-bool buttonAPressed = false;
-bool buttonBPressed = false;
-bool buttonBLongPressHandled = false;
-unsigned long lastButtonCheck = 0;
 bool wasPreviouslyConnected = false;
 unsigned long startupTime = 0;
 bool logoShown = false;
 
-void checkButtons() {
-    M5.update();
-    
-    // Check if we're on the connection screen to handle its specific button logic
-    bool onConnectionScreen = (screenManager.getCurrentScreenType() == SCREEN_CONNECTION);
-    
-    // Track if Button A is being held for a long press
-    static unsigned long btnAHoldStartTime = 0;
-    static bool btnALongPressHandled = false;
-    
-    // Button A handling
-    if (M5.BtnA.isPressed()) {
-        // Button is currently pressed
-        if (btnAHoldStartTime == 0) {
-            // Just started pressing
-            btnAHoldStartTime = millis();
-            btnALongPressHandled = false;
-        } else if (!btnALongPressHandled && (millis() - btnAHoldStartTime >= LONG_PRESS_DURATION)) {
-            // Long press detected and not yet handled
-            btnALongPressHandled = true;
-            
-            // Cycle through screens
-            ScreenType currentScreen = screenManager.getCurrentScreenType();
-            
-            // Skip SCREEN_LOGO when cycling manually
-            if (currentScreen == SCREEN_STATUS) {
-                screenManager.switchToScreen(SCREEN_CONTROLLER);
-            } else if (currentScreen == SCREEN_CONTROLLER) {
-                screenManager.switchToScreen(SCREEN_CONNECTION);
-            } else if (currentScreen == SCREEN_CONNECTION) {
-                screenManager.switchToScreen(SCREEN_STATUS);
-            } else if (currentScreen == SCREEN_LOGO) {
-                // Skip logo screen and go directly to status
-                screenManager.switchToScreen(SCREEN_STATUS);
-                logoShown = true; // Mark logo as shown so we don't go back to it
-            }
-        }
-    } else if (M5.BtnA.wasReleased()) {
-        // Button was just released
-        if (btnAHoldStartTime > 0 && !btnALongPressHandled && onConnectionScreen && connectionScreen) {
-            // This was a short press since long press wasn't handled
-            connectionScreen->connectToSelected();
-        }
-        // Reset the tracking variables
-        btnAHoldStartTime = 0;
-    }
-    
-    // Handle Button B for connection screen 
-    if (onConnectionScreen && connectionScreen) {
-        // Track long press state to avoid double-triggering
-        if (M5.BtnB.isHolding()) {
-            // Button B is being held down
-            if (!buttonBLongPressHandled && millis() - M5.BtnB.lastChange() >= LONG_PRESS_DURATION) {
-                // This is a long press and we haven't handled it yet
-                connectionScreen->selectPrevious();
-                buttonBLongPressHandled = true;
-            }
-        } else if (M5.BtnB.wasPressed()) {
-            // Short press (new press) - only handle if no long press was handled
-            buttonBLongPressHandled = false;
-        } else if (M5.BtnB.wasReleased()) {
-            // Button was released - if no long press was handled, treat as short press
-            if (!buttonBLongPressHandled) {
-                connectionScreen->selectNext();
-            }
-            // Reset the long press handled flag
-            buttonBLongPressHandled = false;
-        }
-    }
+// Copy what the screens show into the render task's snapshot
+void publishUiSnapshot() {
+  UiSnapshot snapshot;
+  memcpy(snapshot.channels, channelManager.getChannelData(), sizeof(snapshot.channels));
+  snapshot.connected = inputController.isConnected();
+  snapshot.status = inputController.getStatus();
+  snapshot.statusGeneration = inputController.getStatusGeneration();
+  
+  ReportRateStats stats;
+  if (inputController.getReportStats(stats)) {
+    snapshot.reportRate = stats.rateHz;
+    snapshot.reportGaps = stats.gaps;
+  } else {
+    snapshot.reportRate = 0;
+    snapshot.reportGaps = 0;
+  }
+  screenManager.publish(snapshot);
 }
 
 // Check if PS5 controller has a saved MAC address
 bool hasSavedMacAddress() {
-    String savedMac = "";
-    Preferences preferences;
-    bool prefsOpened = false;
-    
-    // First try read-only mode
-    prefsOpened = preferences.begin("ps5bridge", true);
-    
-    if (!prefsOpened) {
-        // If read-only failed, try read-write which will create the namespace
-        prefsOpened = preferences.begin("ps5bridge", false);
-    }
-    
-    if (prefsOpened) {
-        savedMac = preferences.getString("mac", "");
-        preferences.end();
-    }
-    
-    return savedMac.length() > 0;
+    return ConfigStore::get().lastMac[0] != '\0';
+}
+
+#ifdef REPLAY_TRACE
+void startReplay() {
+  // Fall back to a synthetic trace when no file has been uploaded
+  if (!replaySource.loadFile(REPLAY_TRACE)) {
+    replaySource.loadSynthetic(5000, 1, 4);
+    LOG_I(LOG_REPLAY, "Using synthetic trace");
+  }
+  
+  // Benchmark the pipeline once, the digest identifies the produced frames
+  ReplayEngine engine;
+  ReplayResult result = engine.run(replaySource.getReports(), replaySource.getReportCount());
+  LOG_I(LOG_REPLAY, "%u frames, digest %08X, %u us (%u frames/s)",
+        result.frames, result.digest, result.elapsedUs,
+        result.elapsedUs ? (unsigned)(result.frames * 1000000ULL / result.elapsedUs) : 0);
+  
+  // Then play it in real time through the controller in place of the ps5 library
+  ps5Controller.setInputSource(&replaySource);
+  replaySource.start(true);
 }
+#endif
 
 void setup() {
+  BootTimeline::mark(BOOT_SETUP);
+  
+  // RF output first: the receiver gets failsafe frames while the rest starts
+  crsfModule.begin();
+  
   // Initialize M5StickCPlus2
   M5.begin();
+  BootTimeline::mark(BOOT_DISPLAY_READY);
+  crsfModule.update();
   
   // Initialize serial
   Serial.begin(115200);
   
+  // Serial output goes through the deferred log from here on
+  Log::begin();
+  
+  // Settings are read from flash once, everything else uses the RAM copy
+  ConfigStore::begin();
+  BootTimeline::mark(BOOT_CONFIG_LOADED);
+  
+  // Start Bluetooth now; the stack comes up on its own task while the
+  // screens are set up. The PS5 controller connects only if a MAC address
+  // is saved, the BLE gamepad searches by itself. Stack restarts, scans and
+  // pages come from different tasks and take turns on the Bluetooth lock
+  BluetoothLock::begin();
+  inputController.begin();
+  crsfModule.update();
+  
   // Record startup time
   startupTime = millis();
   
-  Serial.println("Starting PS5 to CRSF Bridge");
+  LOG_I(LOG_MAIN, "Starting PS5 to CRSF Bridge");
   
   // Increase task watchdog timeout to prevent crashes during BLE scanning
   // This is especially needed for Bluetooth operations which can be intensive
@@ -164,39 +164,71 @@ void setup() {
   
   // Set up screens
   LogoScreen* logoScreen = new LogoScreen();
-  StatusScreen* statusScreen = new StatusScreen(&ps5Controller);
-  ControllerScreen* controllerScreen = new ControllerScreen(&ps5Controller, &channelManager);
-  connectionScreen = new ConnectionScreen(&ps5Controller);
+  StatusScreen* statusScreen = new StatusScreen(&flightRecorder);
+  ControllerScreen* controllerScreen = new ControllerScreen(&flightRecorder);
+#if !BLE_GAMEPAD
+  ConnectionScreen* connectionScreen = new ConnectionScreen(&ps5Controller);
   
   // Mark the connection screen for first-time activation
   // This will trigger auto-scanning if no saved MAC is found
   connectionScreen->setFirstActivation(true);
+#endif
   
   // Register screens with manager
   screenManager.registerScreen(SCREEN_LOGO, logoScreen);
   screenManager.registerScreen(SCREEN_STATUS, statusScreen);
   screenManager.registerScreen(SCREEN_CONTROLLER, controllerScreen);
+#if !BLE_GAMEPAD
   screenManager.registerScreen(SCREEN_CONNECTION, connectionScreen);
+#endif
   
-  // Start with logo screen
+  // Start with logo screen; it is drawn by the render task and holds up nothing
   screenManager.switchToScreen(SCREEN_LOGO);
   
+  // Screens are drawn by their own task from here on; it also takes the
+  // button events, which come from interrupts rather than loop polling
+  DeviceButtons::begin();
+  screenManager.begin();
+  
   // Reset channels to center position
   channelManager.resetChannels();
   
-  // Initialize PS5 controller (but don't start search automatically)
-  // It will connect if a MAC address is saved
-  ps5Controller.begin();
+#ifdef REPLAY_TRACE
+  // Load the trace before the recorder task mounts LittleFS
+  startReplay();
+#endif
+  
+  // Start the flight recorder and capture every transmitted frame
+  flightRecorder.begin();
+  crsfModule.setRecorder(&flightRecorder);
+  
+  // Clock scaling from here on; setup() itself ran at full clock
+  PowerManager::begin();
+  
+  BootTimeline::mark(BOOT_SETUP_DONE);
+  
+  // setup() runs on the loop task, count what loop() allocates from here on
+  AllocCounter::watchCurrentTask();
 }
 
 void loop() {
-  // Check if it's time to initialize CRSF and switch from logo
-  if (!logoShown && (millis() - startupTime > 2000)) {
-    // Initialize CRSF module after 2 second delay
-    crsfModule.begin();
-    
+  // Input and RF work run at full clock, the rest of the frame period may not
+  PowerManager::lockMaxFrequency();
+  
+  // A long press on BtnA skips the logo
+  if (!logoShown && screenManager.getCurrentScreenType() != SCREEN_LOGO) {
+    logoShown = true;
+  }
+  
+  // Leave the logo once it has been up for a while; CRSF and Bluetooth
+  // have been running since setup()
+  if (!logoShown && (millis() - startupTime > LOGO_DISPLAY_MS)) {
     // Check if we have a saved MAC address
+#if BLE_GAMEPAD
+    bool hasMac = true;
+#else
     bool hasMac = hasSavedMacAddress();
+#endif
     
     if (hasMac) {
       // We have a saved MAC address, go to status screen
@@ -210,7 +242,13 @@ void loop() {
   }
   
   // Update controller (reads inputs and updates channels)
-  ps5Controller.update();
+  inputController.update();
+  
+  // Let the flight recorder see link changes (saves a recording on link loss)
+  flightRecorder.setLinkState(inputController.isConnected());
+  if (inputController.isConnected()) {
+    BootTimeline::mark(BOOT_CONNECTED);
+  }
   
   // Update CRSF transmission
   crsfModule.update();
@@ -218,7 +256,7 @@ void loop() {
   // Auto-switch screens based on controller connection status
   // Only after logo screen has been shown and not on connection screen
   if (logoShown && screenManager.getCurrentScreenType() != SCREEN_CONNECTION) {
-    bool isConnected = ps5Controller.isConnected();
+    bool isConnected = inputController.isConnected();
     if (isConnected != wasPreviouslyConnected) {
       // Connection state changed
       if (isConnected) {
@@ -232,16 +270,67 @@ void loop() {
     }
   }
   
-  // Update display
-  screenManager.update();
+  // Hand the display its state; drawing happens on the render task
+  publishUiSnapshot();
   
-  // Check buttons every 100ms
+  // Input report meter on serial, to line up input starvation with flight logs
   unsigned long currentTime = millis();
-  if (currentTime - lastButtonCheck > 100) {
-    checkButtons();
-    lastButtonCheck = currentTime;
+  static unsigned long lastReportStats = 0;
+  static ReportRateStats lastStats;
+  if (currentTime - lastReportStats >= REPORT_STATS_INTERVAL_MS) {
+    ReportRateStats stats;
+    if (inputController.isConnected() && inputController.getReportStats(stats)) {
+      // Gaps and the histogram per log interval, the longest gap and the
+      // drops over the link session (they restart on every connect)
+      if (stats.session != lastStats.session) {
+        memset(&lastStats, 0, sizeof(lastStats));
+      }
+      uint32_t h[REPORT_HISTOGRAM_BINS];
+      for (int i = 0; i < REPORT_HISTOGRAM_BINS; i++) {
+        h[i] = stats.histogram[i] - lastStats.histogram[i];
+      }
+      LOG_I(LOG_INPUT, "reports: %u Hz, %u gaps over %u ms in the last %u s",
+            stats.rateHz, stats.gaps - lastStats.gaps, REPORT_GAP_THRESHOLD_MS, REPORT_STATS_INTERVAL_MS / 1000);
+      LOG_I(LOG_INPUT, "reports: longest gap %u us since connect", stats.longestGapUs);
+      LOG_I(LOG_INPUT, "inter-arrival <2/<4/<8/<16 ms: %u/%u/%u/%u", h[0], h[1], h[2], h[3]);
+      LOG_I(LOG_INPUT, "inter-arrival <32/<64/<128/more: %u/%u/%u/%u", h[4], h[5], h[6], h[7]);
+      if (stats.overflows > lastStats.overflows) {
+        LOG_W(LOG_INPUT, "reports: %u dropped since connect, the loop fell %u reports behind",
+              stats.overflows, REPORT_QUEUE_SIZE);
+      }
+      lastStats = stats;
+    }
+    lastReportStats = currentTime;
+  }
+  
+  // Share of time at full clock, next to the CRSF frame jitter lines
+  static unsigned long lastPowerStats = 0;
+  if (currentTime - lastPowerStats >= POWER_STATS_INTERVAL_MS) {
+    PowerManager::logStats();
+    lastPowerStats = currentTime;
+  }
+  
+#if HEAP_ALLOC_COUNTER
+  // The steady-state loop should not allocate at all
+  static uint32_t loopIterations = 0;
+  static uint32_t reportedAllocs = 0;
+  static unsigned long lastAllocReport = 0;
+  loopIterations++;
+  if (currentTime - lastAllocReport >= ALLOC_REPORT_INTERVAL_MS) {
+    uint32_t allocs = AllocCounter::getCount();
+    LOG_I(LOG_MAIN, "loop: %u allocations in %u iterations", allocs - reportedAllocs, loopIterations);
+    reportedAllocs = allocs;
+    loopIterations = 0;
+    lastAllocReport = currentTime;
   }
+#endif
   
-  // Small delay to prevent hogging CPU
-  delay(1);
+  // End of the work window. The clock may drop (or the chip sleep) until the
+  // tick the next CRSF frame is due on, which is when the loop runs again.
+  // Reports arriving meanwhile wait in the input source's queue with their
+  // arrival times and are all applied, in order, before that frame, so a
+  // press and release between two frames still reach the toggles and gestures
+  // (the channels themselves are only sampled once per frame, as before)
+  PowerManager::unlockMaxFrequency();
+  vTaskDelay(crsfModule.getTicksUntilNextFrame());
 } 
\ No newline at end of file
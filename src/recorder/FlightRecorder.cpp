@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "FlightRecorder.h"
+#include "../utils/Log.h"
+#include <LittleFS.h>
+#include <algorithm>
+
+FlightRecorder::FlightRecorder() :
+    nextSeq(0),
+    currentUsed(0),
+    prevTimeMs(0),
+    linkUp(false),
+    linkToggled(false),
+    flushing(false),
+    triggerSeq(0),
+    triggerReason(TRIGGER_MANUAL),
+    lostBlocks(0),
+    fileIndex(0),
+    fsMounted(false),
+    flushTaskHandle(nullptr),
+    ringLock(portMUX_INITIALIZER_UNLOCKED) {
+    memset(prevChannels, 0, sizeof(prevChannels));
+}
+
+bool FlightRecorder::begin() {
+    if (flushTaskHandle != nullptr) {
+        return true;
+    }
+    
+    // Low priority on core 0 so flash writes never compete with the loop task
+    BaseType_t created = xTaskCreatePinnedToCore(flushTaskEntry, "recorder", 4096, this, 1, &flushTaskHandle, 0);
+    if (created != pdPASS) {
+        LOG_E(LOG_RECORDER, "Failed to start flush task");
+        flushTaskHandle = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void FlightRecorder::record(const uint16_t* channels) {
+    uint32_t now = millis();
+    
+    // The very first frame just opens a block
+    if (nextSeq == 0) {
+        startBlock(channels, now);
+        return;
+    }
+    
+    // Encode the frame as deltas against the previous one
+    uint8_t frame[RECORD_MAX_FRAME_BYTES];
+    uint32_t mask = linkToggled ? RECORD_MASK_LINK : 0;
+    for (int i = 0; i < RECORD_CHANNELS; i++) {
+        if (channels[i] != prevChannels[i]) {
+            mask |= (1UL << i);
+        }
+    }
+    
+    size_t len = recordPutVarint(frame, now - prevTimeMs);
+    len += recordPutVarint(&frame[len], mask);
+    for (int i = 0; i < RECORD_CHANNELS; i++) {
+        if (mask & (1UL << i)) {
+            len += recordPutVarint(&frame[len], recordZigzag((int32_t)channels[i] - (int32_t)prevChannels[i]));
+        }
+    }
+    
+    // Start a new block when the frame doesn't fit; it becomes that block's keyframe
+    if (currentUsed + len > RECORDER_BLOCK_SIZE) {
+        startBlock(channels, now);
+        return;
+    }
+    
+    // The open block is never read by the flush task, so no lock is needed here
+    uint8_t* block = blocks[(nextSeq - 1) % RECORDER_BLOCK_COUNT];
+    RecordBlockHeader* header = reinterpret_cast<RecordBlockHeader*>(block);
+    memcpy(&block[currentUsed], frame, len);
+    currentUsed += len;
+    header->used = currentUsed;
+    header->frameCount++;
+    
+    memcpy(prevChannels, channels, sizeof(prevChannels));
+    prevTimeMs = now;
+    linkToggled = false;
+}
+
+void FlightRecorder::startBlock(const uint16_t* channels, uint32_t now) {
+    // Reusing a slot overwrites the oldest sealed block, which the flush task may be copying
+    portENTER_CRITICAL(&ringLock);
+    uint32_t seq = nextSeq++;
+    portEXIT_CRITICAL(&ringLock);
+    
+    uint8_t* block = blocks[seq % RECORDER_BLOCK_COUNT];
+    RecordBlockHeader* header = reinterpret_cast<RecordBlockHeader*>(block);
+    header->seq = seq;
+    header->baseTimeMs = now;
+    header->used = sizeof(RecordBlockHeader);
+    header->frameCount = 1;
+    header->linkUp = linkUp ? 1 : 0;
+    memset(header->reserved, 0, sizeof(header->reserved));
+    memcpy(header->keyframe, channels, sizeof(header->keyframe));
+    
+    currentUsed = sizeof(RecordBlockHeader);
+    memcpy(prevChannels, channels, sizeof(prevChannels));
+    prevTimeMs = now;
+    linkToggled = false;
+}
+
+void FlightRecorder::setLinkState(bool isLinkUp) {
+    if (isLinkUp == linkUp) {
+        return;
+    }
+    
+    linkUp = isLinkUp;
+    linkToggled = true;
+    
+#if RECORDER_TRIGGER_ON_LINK_LOSS
+    if (!isLinkUp) {
+        trigger(TRIGGER_LINK_LOSS);
+    }
+#endif
+}
+
+void FlightRecorder::trigger(RecordTriggerReason reason) {
+    // One recording at a time; the running one already covers this moment
+    if (flushing || flushTaskHandle == nullptr || nextSeq == 0) {
+        return;
+    }
+    
+    triggerSeq = nextSeq - 1;
+    triggerReason = reason;
+    flushing = true;
+    xTaskNotifyGive(flushTaskHandle);
+}
+
+bool FlightRecorder::isFlushing() const {
+    return flushing;
+}
+
+uint32_t FlightRecorder::getLostBlocks() const {
+    return lostBlocks;
+}
+
+FlightRecorder::CopyResult FlightRecorder::copySealedBlock(uint32_t seq, uint8_t* out) {
+    CopyResult result;
+    
+    portENTER_CRITICAL(&ringLock);
+    if (seq + 1 >= nextSeq) {
+        // Still the open block (or not started yet)
+        result = COPY_NOT_SEALED;
+    } else if (seq + RECORDER_BLOCK_COUNT < nextSeq) {
+        result = COPY_OVERWRITTEN;
+    } else {
+        memcpy(out, blocks[seq % RECORDER_BLOCK_COUNT], RECORDER_BLOCK_SIZE);
+        result = COPY_OK;
+    }
+    portEXIT_CRITICAL(&ringLock);
+    
+    return result;
+}
+
+void FlightRecorder::flushTaskEntry(void* arg) {
+    static_cast<FlightRecorder*>(arg)->flushTask();
+}
+
+void FlightRecorder::flushTask() {
+    // Mounting (and formatting on first use) can take seconds, keep it off the loop task
+    fsMounted = LittleFS.begin(true);
+    if (fsMounted) {
+        pruneRecordings();
+    } else {
+        LOG_E(LOG_RECORDER, "LittleFS mount failed, recordings disabled");
+    }
+    
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        
+        if (fsMounted) {
+            writeRecording();
+        }
+        flushing = false;
+    }
+}
+
+void FlightRecorder::pruneRecordings() {
+    // Collect recording indices so the oldest can be removed
+    uint16_t indices[RECORDER_MAX_FILES * 2];
+    int count = 0;
+    
+    File root = LittleFS.open("/");
+    File entry = root.openNextFile();
+    while (entry) {
+        unsigned int index;
+        if (sscanf(entry.name(), "rec_%04u.bin", &index) == 1) {
+            if (index >= fileIndex) {
+                fileIndex = index + 1;
+            }
+            if (count < (int)(sizeof(indices) / sizeof(indices[0]))) {
+                indices[count++] = index;
+            }
+        }
+        entry = root.openNextFile();
+    }
+    root.close();
+    
+    // Leave room for one new recording
+    std::sort(indices, indices + count);
+    for (int i = 0; i + RECORDER_MAX_FILES <= count; i++) {
+        char path[24];
+        snprintf(path, sizeof(path), "/rec_%04u.bin", indices[i]);
+        LittleFS.remove(path);
+    }
+}
+
+void FlightRecorder::writeRecording() {
+    pruneRecordings();
+    
+    char path[24];
+    snprintf(path, sizeof(path), "/rec_%04u.bin", fileIndex++);
+    File file = LittleFS.open(path, FILE_WRITE);
+    if (!file) {
+        LOG_E(LOG_RECORDER, "Cannot create %s", path);
+        return;
+    }
+    
+    RecordFileHeader fileHeader;
+    fileHeader.magic = RECORD_FILE_MAGIC;
+    fileHeader.version = RECORD_FILE_VERSION;
+    fileHeader.channelCount = RECORD_CHANNELS;
+    fileHeader.blockSize = RECORDER_BLOCK_SIZE;
+    fileHeader.triggerSeq = triggerSeq;
+    fileHeader.reason = triggerReason;
+    file.write(reinterpret_cast<const uint8_t*>(&fileHeader), sizeof(fileHeader));
+    
+    // Everything still in the ring, then the post-trigger blocks as they are sealed
+    uint32_t seq = (triggerSeq + 1 > RECORDER_BLOCK_COUNT) ? triggerSeq + 1 - RECORDER_BLOCK_COUNT : 0;
+    uint32_t lastSeq = triggerSeq + RECORDER_POST_TRIGGER_BLOCKS;
+    uint32_t lastProgress = millis();
+    int written = 0;
+    uint8_t buffer[RECORDER_BLOCK_SIZE];
+    
+    while (seq <= lastSeq) {
+        CopyResult result = copySealedBlock(seq, buffer);
+        
+        if (result == COPY_OK) {
+            // Zero the unused tail so stale bytes from older blocks never reach the file
+            const RecordBlockHeader* header = reinterpret_cast<const RecordBlockHeader*>(buffer);
+            memset(&buffer[header->used], 0, RECORDER_BLOCK_SIZE - header->used);
+            file.write(buffer, RECORDER_BLOCK_SIZE);
+            written++;
+            seq++;
+            lastProgress = millis();
+        } else if (result == COPY_OVERWRITTEN) {
+            lostBlocks++;
+            seq++;
+        } else {
+            // Frames stopped arriving (e.g. CRSF halted); save what we have
+            if (millis() - lastProgress > RECORDER_FLUSH_TIMEOUT_MS) {
+                break;
+            }
+            vTaskDelay(pdMS_TO_TICKS(50));
+        }
+    }
+    
+    file.close();
+    LOG_I(LOG_RECORDER, "Wrote %d blocks to %s", written, path);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include "RecordFormat.h"
+#include "../Config.h"
+
+// Captures every transmitted RC frame into a RAM ring of delta-encoded blocks.
+// On a trigger (manual or link loss) a low-priority task writes the ring history
+// plus a few post-trigger blocks to a LittleFS file. The RF path only ever
+// encodes into RAM; all file I/O happens on the flush task.
+class FlightRecorder {
+public:
+    FlightRecorder();
+    
+    // Start the flush task (LittleFS is mounted from that task, not here)
+    bool begin();
+    
+    // Record one transmitted frame (called from the RF path)
+    void record(const uint16_t* channels);
+    
+    // Track controller link state, triggers a recording on link loss
+    void setLinkState(bool isLinkUp);
+    
+    // Persist the current ring history to flash
+    void trigger(RecordTriggerReason reason = TRIGGER_MANUAL);
+    
+    // Check if a recording is being written
+    bool isFlushing() const;
+    
+    // Blocks that were overwritten before the flush task could save them
+    uint32_t getLostBlocks() const;
+
+private:
+    enum CopyResult {
+        COPY_OK,
+        COPY_NOT_SEALED,
+        COPY_OVERWRITTEN
+    };
+    
+    // Open a new block with the given frame as its keyframe
+    void startBlock(const uint16_t* channels, uint32_t now);
+    
+    // Copy a sealed block out of the ring (called from the flush task)
+    CopyResult copySealedBlock(uint32_t seq, uint8_t* out);
+    
+    // Flush task body
+    static void flushTaskEntry(void* arg);
+    void flushTask();
+    void writeRecording();
+    void pruneRecordings();
+    
+    alignas(4) uint8_t blocks[RECORDER_BLOCK_COUNT][RECORDER_BLOCK_SIZE];
+    uint32_t nextSeq;        // Sequence number for the next block to open
+    size_t currentUsed;      // Bytes used in the open block
+    uint16_t prevChannels[RECORD_CHANNELS];
+    uint32_t prevTimeMs;
+    bool linkUp;
+    bool linkToggled;        // Link changed since the last recorded frame
+    
+    volatile bool flushing;
+    uint32_t triggerSeq;
+    RecordTriggerReason triggerReason;
+    uint32_t lostBlocks;
+    uint16_t fileIndex;
+    bool fsMounted;
+    
+    TaskHandle_t flushTaskHandle;
+    portMUX_TYPE ringLock;
+};
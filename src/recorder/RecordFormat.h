@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// On-disk layout of flight recordings. This header has no Arduino dependencies
+// so the host-side decoder in tools/recorder can include it unchanged.
+//
+// A recording file is a RecordFileHeader followed by fixed-size blocks. Every
+// block starts with a keyframe holding all channel values, so each block can be
+// decoded on its own even if older blocks were overwritten in the RAM ring.
+// After the keyframe, each frame is stored as:
+//   varint  time delta in ms to the previous frame
+//   varint  change mask (bit N = channel N changed, RECORD_MASK_LINK = link toggled)
+//   varint  zigzag channel delta, once per changed channel in ascending order
+
+#define RECORD_FILE_MAGIC 0x52465443UL  // "CTFR" little-endian
+#define RECORD_FILE_VERSION 1
+#define RECORD_CHANNELS 16
+#define RECORD_MASK_LINK (1UL << RECORD_CHANNELS)
+
+// Longest possible encoded frame: 5 (time) + 3 (mask) + 2 bytes per channel
+#define RECORD_MAX_FRAME_BYTES (5 + 3 + RECORD_CHANNELS * 2)
+
+struct RecordFileHeader {
+    uint32_t magic;       // RECORD_FILE_MAGIC
+    uint8_t version;      // RECORD_FILE_VERSION
+    uint8_t channelCount; // RECORD_CHANNELS
+    uint16_t blockSize;   // Size of every block that follows, in bytes
+    uint32_t triggerSeq;  // Sequence number of the block that was open at trigger time
+    uint32_t reason;      // RecordTriggerReason
+};
+
+struct RecordBlockHeader {
+    uint32_t seq;                        // Monotonic block sequence number
+    uint32_t baseTimeMs;                 // millis() of the keyframe
+    uint16_t used;                       // Bytes used in this block, header included
+    uint16_t frameCount;                 // Frames in this block, keyframe included
+    uint8_t linkUp;                      // Link state at the keyframe
+    uint8_t reserved[3];
+    uint16_t keyframe[RECORD_CHANNELS];  // Absolute channel values of the first frame
+};
+
+enum RecordTriggerReason {
+    TRIGGER_MANUAL = 0,
+    TRIGGER_LINK_LOSS = 1
+};
+
+// Append an unsigned LEB128 varint, returns bytes written
+inline size_t recordPutVarint(uint8_t* out, uint32_t value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+// Read an unsigned LEB128 varint, returns bytes consumed or 0 on truncation
+inline size_t recordGetVarint(const uint8_t* in, size_t avail, uint32_t* value) {
+    uint32_t result = 0;
+    for (size_t n = 0; n < avail && n < 5; n++) {
+        result |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+        if ((in[n] & 0x80) == 0) {
+            *value = result;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+// Map signed deltas to unsigned so small negative values stay short
+inline uint32_t recordZigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+inline int32_t recordUnzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
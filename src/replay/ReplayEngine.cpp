@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ReplayEngine.h"
+#include "../crsf/CRSFFrame.h"
+
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+
+ReplayEngine::ReplayEngine() :
+    mapper(&channelManager) {
+}
+
+PS5InputMapper& ReplayEngine::getMapper() {
+    return mapper;
+}
+
+ReplayResult ReplayEngine::run(const PS5Report* reports, size_t count, ReplayFrameSink sink, void* context) {
+    ReplayResult result;
+    result.frames = 0;
+    result.digest = FNV_OFFSET_BASIS;
+    
+    // Start from the same state the controller has after a fresh connection
+    channelManager.resetChannels();
+    mapper.resetAllButtons();
+    
+    uint8_t frame[CRSF_FRAME_SIZE];
+    unsigned long start = micros();
+    
+    for (size_t i = 0; i < count; i++) {
+        mapper.apply(reports[i]);
+        buildRcChannelsFrame(frame, channelManager.getChannelData());
+        
+        for (size_t b = 0; b < CRSF_FRAME_SIZE; b++) {
+            result.digest = (result.digest ^ frame[b]) * FNV_PRIME;
+        }
+        if (sink != nullptr) {
+            sink(frame, CRSF_FRAME_SIZE, context);
+        }
+        result.frames++;
+    }
+    
+    result.elapsedUs = micros() - start;
+    return result;
+}
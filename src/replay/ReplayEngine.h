@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../channels/ChannelManager.h"
+#include "../controllers/PS5InputMapper.h"
+
+// Called for every CRSF frame the replay produces
+typedef void (*ReplayFrameSink)(const uint8_t* frame, size_t length, void* context);
+
+struct ReplayResult {
+    uint32_t frames;     // Frames produced (one per report)
+    uint32_t digest;     // FNV-1a over every frame byte, for regression checks
+    uint32_t elapsedUs;  // Wall time spent in the pipeline
+};
+
+// Drives a report trace through the same mapping and CRSF packing used on the
+// RF path, without a controller or a UART. The same trace always produces the
+// same frames, so the digest can be compared across builds.
+class ReplayEngine {
+public:
+    ReplayEngine();
+    
+    // Access the mapper to apply a non-default button configuration
+    PS5InputMapper& getMapper();
+    
+    // Run a trace from a clean state, frames are passed to sink if given
+    ReplayResult run(const PS5Report* reports, size_t count, ReplayFrameSink sink = nullptr, void* context = nullptr);
+
+private:
+    ChannelManager channelManager;
+    PS5InputMapper mapper;
+};
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TraceFormat.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+bool parseTraceLine(const char* line, PS5Report& report) {
+    const int fieldCount = 8;
+    long fields[fieldCount];
+    const char* p = line;
+    
+    // Skip leading whitespace, comments and blank lines
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p == '#' || *p == '\0' || *p == '\r' || *p == '\n') {
+        return false;
+    }
+    
+    for (int i = 0; i < fieldCount; i++) {
+        char* end;
+        fields[i] = strtol(p, &end, 0);
+        if (end == p) {
+            return false;
+        }
+        p = end;
+        while (*p == ' ' || *p == '\t') p++;
+        if (i < fieldCount - 1) {
+            if (*p != ',') {
+                return false;
+            }
+            p++;
+        }
+    }
+    
+    report.timeMs = (uint32_t)fields[0];
+    report.leftX = (int8_t)fields[1];
+    report.leftY = (int8_t)fields[2];
+    report.rightX = (int8_t)fields[3];
+    report.rightY = (int8_t)fields[4];
+    report.l2 = (uint8_t)fields[5];
+    report.r2 = (uint8_t)fields[6];
+    report.buttons = (uint32_t)fields[7];
+    return true;
+}
+
+int formatTraceLine(char* buffer, size_t size, const PS5Report& report) {
+    return snprintf(buffer, size, "%lu,%d,%d,%d,%d,%u,%u,0x%lx",
+                    (unsigned long)report.timeMs,
+                    report.leftX, report.leftY, report.rightX, report.rightY,
+                    report.l2, report.r2, (unsigned long)report.buttons);
+}
+
+// Triangle wave in [-range, range] with the given period
+static int triangleWave(uint32_t t, uint32_t period, int range) {
+    uint32_t phase = t % period;
+    int ramp = (int)((phase * 4 * range) / period);
+    if (ramp < 2 * range) {
+        return ramp - range;
+    }
+    return 3 * range - ramp;
+}
+
+// Buttons the synthetic trace presses: the twelve PS5Button had when the
+// generator was written. Fixed so that adding buttons does not change the
+// trace, and with it every digest recorded against it
+#define SYNTHETIC_BUTTON_COUNT 12
+
+void synthesizeTrace(PS5Report* reports, size_t count, uint32_t seed, uint32_t intervalMs) {
+    uint32_t state = seed ? seed : 1;
+    uint32_t held = 0;
+    
+    for (size_t i = 0; i < count; i++) {
+        // xorshift32 keeps the trace identical on every platform
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        
+        uint32_t t = (uint32_t)i * intervalMs;
+        PS5Report& report = reports[i];
+        report.timeMs = t;
+        report.leftX = (int8_t)triangleWave(t, 2000, 127);
+        report.leftY = (int8_t)triangleWave(t + 500, 3100, 127);
+        report.rightX = (int8_t)triangleWave(t + 900, 1700, 127);
+        report.rightY = (int8_t)triangleWave(t + 300, 2300, 127);
+        report.l2 = (uint8_t)(triangleWave(t, 1300, 127) + 128);
+        report.r2 = (uint8_t)(triangleWave(t + 650, 1300, 127) + 128);
+        
+        // Roughly one button edge every eight reports
+        if ((state & 0x7) == 0) {
+            held ^= PS5_BUTTON_BIT((state >> 3) % SYNTHETIC_BUTTON_COUNT);
+        }
+        report.buttons = held;
+    }
+}
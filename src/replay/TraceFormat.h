@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stddef.h>
+#include "../controllers/PS5Report.h"
+
+// Input traces are plain CSV, one report per line:
+//   time_ms,left_x,left_y,right_x,right_y,l2,r2,buttons
+// Sticks are -128..127, triggers 0..255, buttons is a PS5_BUTTON_BIT mask
+// (decimal or 0x-prefixed hex). Lines starting with '#' are comments.
+
+// Parse one trace line, returns false for comments, blank or malformed lines
+bool parseTraceLine(const char* line, PS5Report& report);
+
+// Format one report as a trace line (buffer should hold at least 64 bytes)
+int formatTraceLine(char* buffer, size_t size, const PS5Report& report);
+
+// Fill a deterministic synthetic trace: sweeping sticks and triggers with
+// buttons pressed and held in pseudo-random patterns derived from seed
+void synthesizeTrace(PS5Report* reports, size_t count, uint32_t seed, uint32_t intervalMs);
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TraceReplaySource.h"
+#include "../utils/Log.h"
+#include "TraceFormat.h"
+#include <LittleFS.h>
+
+TraceReplaySource::TraceReplaySource() :
+    nextIndex(0),
+    startTime(0),
+    playing(false),
+    looping(false) {
+}
+
+bool TraceReplaySource::loadFile(const char* path) {
+    reports.clear();
+    
+    if (!LittleFS.begin(true)) {
+        LOG_E(LOG_REPLAY, "LittleFS mount failed");
+        return false;
+    }
+    
+    File file = LittleFS.open(path, FILE_READ);
+    if (!file) {
+        LOG_E(LOG_REPLAY, "Cannot open %s", path);
+        return false;
+    }
+    
+    char line[96];
+    size_t length = 0;
+    while (file.available()) {
+        int c = file.read();
+        if (c == '\n' || length == sizeof(line) - 1) {
+            line[length] = '\0';
+            PS5Report report;
+            if (parseTraceLine(line, report)) {
+                reports.push_back(report);
+            }
+            length = 0;
+        } else {
+            line[length++] = (char)c;
+        }
+    }
+    if (length > 0) {
+        line[length] = '\0';
+        PS5Report report;
+        if (parseTraceLine(line, report)) {
+            reports.push_back(report);
+        }
+    }
+    file.close();
+    
+    LOG_I(LOG_REPLAY, "Loaded %u reports from %s", (unsigned)reports.size(), path);
+    return !reports.empty();
+}
+
+void TraceReplaySource::loadSynthetic(size_t count, uint32_t seed, uint32_t intervalMs) {
+    reports.resize(count);
+    synthesizeTrace(reports.data(), count, seed, intervalMs);
+}
+
+void TraceReplaySource::start(bool loopPlayback) {
+    nextIndex = 0;
+    startTime = millis();
+    looping = loopPlayback;
+    playing = !reports.empty();
+}
+
+const PS5Report* TraceReplaySource::getReports() const {
+    return reports.data();
+}
+
+size_t TraceReplaySource::getReportCount() const {
+    return reports.size();
+}
+
+bool TraceReplaySource::isConnected() {
+    return playing;
+}
+
+bool TraceReplaySource::poll(PS5Report& report) {
+    if (!playing) {
+        return false;
+    }
+    
+    if (nextIndex >= reports.size()) {
+        if (looping) {
+            start(true);
+        } else {
+            playing = false;
+        }
+        return false;
+    }
+    
+    // Release each report once its offset from the first report has elapsed
+    uint32_t offset = reports[nextIndex].timeMs - reports[0].timeMs;
+    if (millis() - startTime < offset) {
+        return false;
+    }
+    
+    report = reports[nextIndex++];
+    return true;
+}
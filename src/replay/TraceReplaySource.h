@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+#include "../controllers/PS5InputSource.h"
+
+// Plays a recorded or synthetic trace into PS5Controller in real time, in place
+// of the ps5 library. Report timestamps are kept from the trace, so button
+// timing (double presses) behaves exactly as it did when the trace was taken.
+class TraceReplaySource : public PS5InputSource {
+public:
+    TraceReplaySource();
+    
+    // Load a CSV trace from LittleFS (see TraceFormat.h)
+    bool loadFile(const char* path);
+    
+    // Use a synthetic trace instead of a file
+    void loadSynthetic(size_t count, uint32_t seed, uint32_t intervalMs);
+    
+    // Start playback from the first report
+    void start(bool loopPlayback = false);
+    
+    // Access the loaded trace (e.g. for ReplayEngine benchmarks)
+    const PS5Report* getReports() const;
+    size_t getReportCount() const;
+    
+    bool isConnected() override;
+    bool poll(PS5Report& report) override;
+
+private:
+    std::vector<PS5Report> reports;
+    size_t nextIndex;
+    unsigned long startTime;
+    bool playing;
+    bool looping;
+};
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "AllocCounter.h"
+#include "../Config.h"
+
+static TaskHandle_t volatile watchedTask = nullptr;
+static volatile uint32_t allocCount = 0;
+
+void AllocCounter::watchCurrentTask() {
+    watchedTask = xTaskGetCurrentTaskHandle();
+}
+
+uint32_t AllocCounter::getCount() {
+    return allocCount;
+}
+
+#if HEAP_ALLOC_COUNTER
+// Linked with -Wl,--wrap so every malloc/calloc/realloc, including those from
+// String and operator new, passes through here first
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+static inline void noteAllocation() {
+    if (watchedTask != nullptr && xTaskGetCurrentTaskHandle() == watchedTask) {
+        allocCount++;
+    }
+}
+
+void* __wrap_malloc(size_t size) {
+    noteAllocation();
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    noteAllocation();
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    noteAllocation();
+    return __real_realloc(ptr, size);
+}
+}
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BluetoothLock.h"
+#include "Log.h"
+
+SemaphoreHandle_t BluetoothLock::mutex = nullptr;
+
+void BluetoothLock::begin() {
+    if (mutex != nullptr) {
+        return;
+    }
+    
+    mutex = xSemaphoreCreateMutex();
+    if (mutex == nullptr) {
+        LOG_E(LOG_MAIN, "Failed to create Bluetooth lock");
+    }
+}
+
+bool BluetoothLock::take(TickType_t wait) {
+    if (mutex == nullptr) {
+        return true;
+    }
+    return xSemaphoreTake(mutex, wait) == pdTRUE;
+}
+
+void BluetoothLock::give() {
+    if (mutex != nullptr) {
+        xSemaphoreGive(mutex);
+    }
+}
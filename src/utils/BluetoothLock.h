@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+
+// Serializes Bluedroid control calls made from different tasks: the ps5
+// library's end()/begin() on the btlink task, discovery through SerialBT on
+// the ui task and paging from the loop. Bluedroid runs each request on its
+// own task, but a stack restart interleaved with a discovery start leaves
+// both half done. Before begin() everything runs on the setup task and the
+// lock is a no-op.
+class BluetoothLock {
+public:
+    // Create the mutex (setup, before any task makes Bluedroid calls)
+    static void begin();
+    
+    // Returns false if the lock was not free within the wait
+    static bool take(TickType_t wait = portMAX_DELAY);
+    static void give();
+
+private:
+    static SemaphoreHandle_t mutex;
+};
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BootTimeline.h"
+#include "Log.h"
+
+// Indexed by BootMilestone
+static const char* const milestoneNames[BOOT_MILESTONE_COUNT] = {
+    "setup",
+    "first CRSF frame",
+    "display ready",
+    "config loaded",
+    "setup done",
+    "bluetooth started",
+    "logo drawn",
+    "controller connected"
+};
+
+std::atomic<uint32_t> BootTimeline::times[BOOT_MILESTONE_COUNT];
+
+void BootTimeline::mark(BootMilestone milestone) {
+    if (milestone >= BOOT_MILESTONE_COUNT || times[milestone].load(std::memory_order_relaxed) != 0) {
+        return;
+    }
+    
+    // 0 means not reached, a milestone at the very first microsecond becomes 1
+    uint32_t now = micros();
+    if (now == 0) {
+        now = 1;
+    }
+    
+    uint32_t expected = 0;
+    if (times[milestone].compare_exchange_strong(expected, now)) {
+        LOG_I(LOG_MAIN, "boot: %s at %u.%03u ms", milestoneNames[milestone], now / 1000, now % 1000);
+    }
+}
+
+uint32_t BootTimeline::get(BootMilestone milestone) {
+    return milestone < BOOT_MILESTONE_COUNT ? times[milestone].load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+// Boot stages, in the order they are expected
+enum BootMilestone : uint8_t {
+    BOOT_SETUP = 0,          // setup() entered
+    BOOT_FIRST_FRAME,        // First CRSF frame sent
+    BOOT_DISPLAY_READY,      // M5.begin() done
+    BOOT_CONFIG_LOADED,      // Settings in RAM
+    BOOT_SETUP_DONE,         // setup() returned, loop() starts
+    BOOT_BT_STARTED,         // Bluetooth stack up and targeting a controller
+    BOOT_LOGO_DRAWN,         // Logo on the panel (cosmetic, render task)
+    BOOT_CONNECTED,          // First controller connection
+    BOOT_MILESTONE_COUNT
+};
+
+// Time from reset to each boot milestone. Milestones are reached on several
+// tasks; each is recorded and logged once. Times count from the start of the
+// application (esp_timer), so the ROM and second-stage bootloader come on top.
+class BootTimeline {
+public:
+    // Record a milestone the first time it is reached (any task)
+    static void mark(BootMilestone milestone);
+    
+    // Microseconds since start, 0 when not reached yet
+    static uint32_t get(BootMilestone milestone);
+
+private:
+    static std::atomic<uint32_t> times[BOOT_MILESTONE_COUNT];
+};
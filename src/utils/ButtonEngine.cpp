@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ButtonEngine.h"
+
+ButtonEngine::ButtonEngine() :
+    previousMask(0),
+    momentaryMask(0xFFFFFFFFUL),
+    activeMask(0) {
+    
+    // Every button starts out momentary
+    for (int i = 0; i < BUTTON_ENGINE_MAX_BUTTONS; i++) {
+        numStates[i] = 2;
+        states[i] = 0;
+        lastPress[i] = 0;
+    }
+}
+
+void ButtonEngine::setNumStates(uint8_t button, int newNumStates) {
+    if (button >= BUTTON_ENGINE_MAX_BUTTONS) {
+        return;
+    }
+    
+    uint32_t bit = 1UL << button;
+    
+    // State count ≤ 1 means momentary mode, which still has 2 internal states
+    if (newNumStates <= 1) {
+        momentaryMask |= bit;
+        numStates[button] = 2;
+    } else {
+        momentaryMask &= ~bit;
+        numStates[button] = (uint8_t)min(255, newNumStates);
+    }
+    
+    // Reset to first state
+    states[button] = 0;
+    activeMask &= ~bit;
+}
+
+HOT_FUNC void ButtonEngine::update(uint32_t heldMask, unsigned long currentTime) {
+    uint32_t changed = heldMask ^ previousMask;
+    uint32_t pressed = changed & heldMask;
+    previousMask = heldMask;
+    
+    // Momentary buttons simply follow the held mask
+    activeMask = (activeMask & ~momentaryMask) | (heldMask & momentaryMask);
+    
+    // Toggles only change on a press edge
+    uint32_t toggled = pressed & ~momentaryMask;
+    while (toggled) {
+        int button = __builtin_ctz(toggled);
+        toggled &= toggled - 1;
+        
+        if (currentTime - lastPress[button] < DOUBLE_PRESS_TIME) {
+            // Double press detected - reset to first state
+            states[button] = 0;
+        } else {
+            // Single press - advance to next state
+            states[button] = (states[button] + 1) % numStates[button];
+        }
+        lastPress[button] = currentTime;
+        
+        if (states[button]) {
+            activeMask |= (1UL << button);
+        } else {
+            activeMask &= ~(1UL << button);
+        }
+    }
+}
+
+int ButtonEngine::getState(uint8_t button) const {
+    if (button >= BUTTON_ENGINE_MAX_BUTTONS) {
+        return 0;
+    }
+    if (momentaryMask & (1UL << button)) {
+        return (previousMask >> button) & 1;
+    }
+    return states[button];
+}
+
+HOT_FUNC int ButtonEngine::getValue(uint8_t button) const {
+    int state = getState(button);
+    int count = (button < BUTTON_ENGINE_MAX_BUTTONS) ? numStates[button] : 2;
+    
+    if (count == 3 && state == 1) {
+        // Special case for 3-position toggle: use the defined MID value
+        return CHANNEL_VALUE_MID;
+    }
+    
+    // Momentary and 2-position toggles land on MIN/MAX, others are spread evenly
+    return CHANNEL_VALUE_MIN + ((CHANNEL_VALUE_MAX - CHANNEL_VALUE_MIN) * state / (count - 1));
+}
+
+uint32_t ButtonEngine::getActiveMask() const {
+    return activeMask;
+}
+
+void ButtonEngine::reset() {
+    previousMask = 0;
+    activeMask = 0;
+    for (int i = 0; i < BUTTON_ENGINE_MAX_BUTTONS; i++) {
+        states[i] = 0;
+        lastPress[i] = 0;
+    }
+}
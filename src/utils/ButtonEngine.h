@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include "../Config.h"
+
+// Maximum number of buttons in one engine (one bit each in the report mask)
+#define BUTTON_ENGINE_MAX_BUTTONS 32
+
+// Momentary and N-state toggle handling for a whole controller at once. Each
+// report is one bitmask of held buttons; press and release edges come from a
+// single XOR/AND, and only buttons with a press edge touch their counters.
+class ButtonEngine {
+public:
+    ButtonEngine();
+    
+    // Change number of states for a button (≤1 momentary, otherwise toggle)
+    void setNumStates(uint8_t button, int numStates);
+    
+    // Process one report: bit N set while button N is held, time in ms
+    void update(uint32_t heldMask, unsigned long currentTime);
+    
+    // Get current state of a button (0 to numStates-1)
+    int getState(uint8_t button) const;
+    
+    // Get channel value for a button - calculated on demand
+    int getValue(uint8_t button) const;
+    
+    // Buttons whose state is not the first one (pressed or toggled on)
+    uint32_t getActiveMask() const;
+    
+    // Reset all buttons to their first state
+    void reset();
+
+private:
+    uint32_t previousMask;   // Held buttons in the previous report
+    uint32_t momentaryMask;  // Buttons in momentary mode
+    uint32_t activeMask;     // Buttons with state > 0
+    uint8_t numStates[BUTTON_ENGINE_MAX_BUTTONS];
+    uint8_t states[BUTTON_ENGINE_MAX_BUTTONS];
+    unsigned long lastPress[BUTTON_ENGINE_MAX_BUTTONS];
+};
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ConfigStore.h"
+#include "Log.h"
+#include "Utils.h"
+#include <Preferences.h>
+
+#define CONFIG_SCHEMA_VERSION 1
+#define CONFIG_NAMESPACE "ps5bridge"
+#define CONFIG_KEY "config"
+
+// Blob as stored; the CRC covers everything before it
+struct StoredConfig {
+    uint16_t version;
+    uint16_t length;
+    ConfigData data;
+    uint32_t crc;
+};
+
+// Bond table blob written by earlier firmware under the "bonds" key
+struct LegacyBonds {
+    uint8_t version;
+    uint8_t count;
+    BondEntry entries[BOND_TABLE_SIZE];
+};
+
+ConfigData ConfigStore::data;
+portMUX_TYPE ConfigStore::lock = portMUX_INITIALIZER_UNLOCKED;
+volatile bool ConfigStore::dirty = false;
+unsigned long ConfigStore::firstChange = 0;
+unsigned long ConfigStore::lastChange = 0;
+uint32_t ConfigStore::storedCrc = 0;
+bool ConfigStore::hasStored = false;
+bool ConfigStore::hasLegacyKeys = false;
+uint32_t ConfigStore::writeCount = 0;
+TaskHandle_t ConfigStore::writeTaskHandle = nullptr;
+
+static uint32_t storedCrcOf(const StoredConfig& stored) {
+    return crc32((const uint8_t*)&stored, offsetof(StoredConfig, crc));
+}
+
+bool ConfigStore::begin() {
+    unsigned long start = micros();
+    bool loaded = load();
+    LOG_I(LOG_MAIN, "Config %s in %lu us", loaded ? "loaded" : "defaulted", micros() - start);
+    
+    if (writeTaskHandle == nullptr &&
+        xTaskCreatePinnedToCore(writeTaskEntry, "config", 3072, nullptr, 1, &writeTaskHandle, 0) != pdPASS) {
+        LOG_E(LOG_MAIN, "Failed to start config write task, settings will not be saved");
+        writeTaskHandle = nullptr;
+    }
+    
+    // A migration is written through the same path as any other change
+    if (dirty && writeTaskHandle != nullptr) {
+        xTaskNotifyGive(writeTaskHandle);
+    }
+    return loaded;
+}
+
+bool ConfigStore::load() {
+    memset(&data, 0, sizeof(data));
+    
+    // The namespace does not exist before the first write
+    Preferences preferences;
+    if (!preferences.begin(CONFIG_NAMESPACE, true)) {
+        return false;
+    }
+    
+    // One read for every setting
+    StoredConfig stored;
+    size_t length = preferences.getBytes(CONFIG_KEY, &stored, sizeof(stored));
+    if (length == sizeof(stored) && stored.version == CONFIG_SCHEMA_VERSION &&
+        stored.length == sizeof(ConfigData) && stored.crc == storedCrcOf(stored)) {
+        preferences.end();
+        data = stored.data;
+        data.lastMac[sizeof(data.lastMac) - 1] = '\0';
+        storedCrc = stored.crc;
+        hasStored = true;
+        return true;
+    }
+    if (length > 0) {
+        LOG_W(LOG_MAIN, "Stored config is damaged or from another version, using defaults");
+    }
+    
+    // Carry over the separate keys of older firmware
+    String legacyMac = preferences.getString("mac", "");
+    LegacyBonds legacyBonds;
+    size_t bondsLength = preferences.getBytes("bonds", &legacyBonds, sizeof(legacyBonds));
+    preferences.end();
+    
+    if (legacyMac.length() > 0) {
+        snprintf(data.lastMac, sizeof(data.lastMac), "%s", legacyMac.c_str());
+        hasLegacyKeys = true;
+    }
+    if (bondsLength == sizeof(legacyBonds) && legacyBonds.version == 1 && legacyBonds.count <= BOND_TABLE_SIZE) {
+        data.bonds.count = legacyBonds.count;
+        memcpy(data.bonds.entries, legacyBonds.entries, sizeof(data.bonds.entries));
+        hasLegacyKeys = true;
+    }
+    if (hasLegacyKeys) {
+        LOG_I(LOG_MAIN, "Migrated settings of older firmware");
+        markDirty();
+    }
+    return false;
+}
+
+const ConfigData& ConfigStore::get() {
+    return data;
+}
+
+void ConfigStore::setLastMac(const char* mac) {
+    portENTER_CRITICAL(&lock);
+    if (strncmp(data.lastMac, mac, sizeof(data.lastMac)) != 0) {
+        strncpy(data.lastMac, mac, sizeof(data.lastMac) - 1);
+        data.lastMac[sizeof(data.lastMac) - 1] = '\0';
+        markDirty();
+    }
+    portEXIT_CRITICAL(&lock);
+    
+    if (dirty && writeTaskHandle != nullptr) {
+        xTaskNotifyGive(writeTaskHandle);
+    }
+}
+
+void ConfigStore::setBonds(const BondList& bonds) {
+    portENTER_CRITICAL(&lock);
+    if (memcmp(&data.bonds, &bonds, sizeof(bonds)) != 0) {
+        data.bonds = bonds;
+        markDirty();
+    }
+    portEXIT_CRITICAL(&lock);
+    
+    if (dirty && writeTaskHandle != nullptr) {
+        xTaskNotifyGive(writeTaskHandle);
+    }
+}
+
+uint32_t ConfigStore::getWriteCount() {
+    return writeCount;
+}
+
+void ConfigStore::markDirty() {
+    unsigned long now = millis();
+    if (!dirty) {
+        firstChange = now;
+    }
+    lastChange = now;
+    dirty = true;
+}
+
+void ConfigStore::retryWrite() {
+    portENTER_CRITICAL(&lock);
+    markDirty();
+    portEXIT_CRITICAL(&lock);
+}
+
+void ConfigStore::write() {
+    // Padding is zeroed so equal settings give equal CRCs
+    StoredConfig stored;
+    memset(&stored, 0, sizeof(stored));
+    portENTER_CRITICAL(&lock);
+    stored.data = data;
+    dirty = false;
+    portEXIT_CRITICAL(&lock);
+    stored.version = CONFIG_SCHEMA_VERSION;
+    stored.length = sizeof(ConfigData);
+    stored.crc = storedCrcOf(stored);
+    
+    // Changed and changed back: flash already holds these bytes
+    if (hasStored && stored.crc == storedCrc && !hasLegacyKeys) {
+        return;
+    }
+    
+    Preferences preferences;
+    if (!preferences.begin(CONFIG_NAMESPACE, false)) {
+        LOG_E(LOG_MAIN, "Failed to open preferences, config not saved");
+        retryWrite();
+        return;
+    }
+    
+    // A short write (NVS full or worn) leaves the old blob; keep the legacy
+    // keys and the last good CRC, and try again after the write delay
+    size_t written = preferences.putBytes(CONFIG_KEY, &stored, sizeof(stored));
+    if (written != sizeof(stored)) {
+        preferences.end();
+        LOG_E(LOG_MAIN, "Config write failed (%u of %u bytes), retrying", (unsigned)written, (unsigned)sizeof(stored));
+        retryWrite();
+        return;
+    }
+    if (hasLegacyKeys) {
+        preferences.remove("mac");
+        preferences.remove("bonds");
+        hasLegacyKeys = false;
+    }
+    preferences.end();
+    
+    storedCrc = stored.crc;
+    hasStored = true;
+    writeCount++;
+    LOG_D(LOG_MAIN, "Config written (%u writes since boot)", writeCount);
+}
+
+void ConfigStore::writeTaskEntry(void* param) {
+    while (true) {
+        // Sleep until something changes, then poll until the changes settle
+        ulTaskNotifyTake(pdTRUE, dirty ? pdMS_TO_TICKS(100) : portMAX_DELAY);
+        if (!dirty) {
+            continue;
+        }
+        
+        unsigned long now = millis();
+        if (now - lastChange >= CONFIG_WRITE_DELAY_MS || now - firstChange >= CONFIG_WRITE_MAX_DELAY_MS) {
+            write();
+        }
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include "../Config.h"
+#include "../controllers/BondTable.h"
+
+// Everything the bridge keeps across power cycles. The stored blob carries a
+// schema version; bump CONFIG_SCHEMA_VERSION in ConfigStore.cpp when this changes.
+struct ConfigData {
+    char lastMac[18];   // Controller used last, "" when none
+    BondList bonds;     // Bonded controllers, most recently used first
+};
+
+// Settings service. The CRC-protected blob is read from flash once at boot into
+// RAM and served from there by reference. Setters change the RAM copy; a
+// low-priority task writes it back once changes have been quiet for
+// CONFIG_WRITE_DELAY_MS, and skips writes that would store what flash holds.
+class ConfigStore {
+public:
+    // Load the blob (or migrate the keys older firmware used) and start the
+    // write-behind task; false when the defaults are in use
+    static bool begin();
+    
+    // The settings in RAM. Setters run on other tasks only on user actions, so
+    // readers use the fields in place
+    static const ConfigData& get();
+    
+    // Change a setting, writes are batched
+    static void setLastMac(const char* mac);
+    static void setBonds(const BondList& bonds);
+    
+    // Blobs written to flash since boot
+    static uint32_t getWriteCount();
+
+private:
+    static bool load();
+    static void markDirty();
+    static void write();
+    
+    // Put the settings back in line for a write after a failed one (write task)
+    static void retryWrite();
+    static void writeTaskEntry(void* param);
+    
+    static ConfigData data;
+    static portMUX_TYPE lock;
+    static volatile bool dirty;
+    static unsigned long firstChange;   // Oldest change not yet written
+    static unsigned long lastChange;
+    static uint32_t storedCrc;          // CRC of the blob in flash
+    static bool hasStored;
+    static bool hasLegacyKeys;          // Keys of older firmware to remove on the next write
+    static uint32_t writeCount;
+    static TaskHandle_t writeTaskHandle;
+};
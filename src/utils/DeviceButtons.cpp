@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "DeviceButtons.h"
+#include "Log.h"
+
+DeviceButtons::State DeviceButtons::states[DEVICE_BUTTON_COUNT];
+QueueHandle_t DeviceButtons::queue = nullptr;
+TaskHandle_t DeviceButtons::listener = nullptr;
+uint32_t DeviceButtons::droppedEvents = 0;
+
+static const uint8_t buttonPins[DEVICE_BUTTON_COUNT] = { BUTTON_A_PIN, BUTTON_B_PIN };
+
+bool DeviceButtons::begin() {
+    if (queue != nullptr) {
+        return true;
+    }
+    
+    queue = xQueueCreate(BUTTON_EVENT_QUEUE_LENGTH, sizeof(ButtonEvent));
+    if (queue == nullptr) {
+        LOG_E(LOG_MAIN, "Failed to create the button event queue");
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < DEVICE_BUTTON_COUNT; i++) {
+        State& state = states[i];
+        state.button = i;
+        state.pin = buttonPins[i];
+        state.edgePending = false;
+        state.edgeMs = 0;
+        state.longSent = false;
+        
+        // GPIO37/39 are input-only with pull-ups on the board
+        pinMode(state.pin, INPUT);
+        state.pressed = digitalRead(state.pin) == LOW;
+        
+        // Timer callbacks run one at a time on the timer task, so the state
+        // they share needs no lock; only the edge fields come from the ISR
+        state.debounceTimer = xTimerCreate("btnDebounce", pdMS_TO_TICKS(BUTTON_DEBOUNCE_MS), pdFALSE, &state, onDebounce);
+        state.holdTimer = xTimerCreate("btnHold", pdMS_TO_TICKS(LONG_PRESS_DURATION), pdTRUE, &state, onHold);
+        if (state.debounceTimer == nullptr || state.holdTimer == nullptr) {
+            LOG_E(LOG_MAIN, "Failed to create the timers of button %d", i);
+            return false;
+        }
+        
+        attachInterruptArg(state.pin, onEdge, &state, CHANGE);
+    }
+    
+    LOG_I(LOG_MAIN, "Buttons on GPIO%d and GPIO%d, interrupt driven", BUTTON_A_PIN, BUTTON_B_PIN);
+    return true;
+}
+
+void DeviceButtons::setListener(TaskHandle_t task) {
+    listener = task;
+}
+
+bool DeviceButtons::poll(ButtonEvent& event) {
+    return queue != nullptr && xQueueReceive(queue, &event, 0) == pdTRUE;
+}
+
+uint32_t DeviceButtons::getDroppedEvents() {
+    return droppedEvents;
+}
+
+void IRAM_ATTR DeviceButtons::onEdge(void* arg) {
+    State* state = static_cast<State*>(arg);
+    
+    // The first edge of a bounce is when the button actually moved
+    if (!state->edgePending) {
+        state->edgeMs = millis();
+        state->edgePending = true;
+    }
+    
+    // Every further edge pushes the debounce timeout back
+    BaseType_t woken = pdFALSE;
+    xTimerResetFromISR(state->debounceTimer, &woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void DeviceButtons::onDebounce(TimerHandle_t timer) {
+    State& state = *static_cast<State*>(pvTimerGetTimerID(timer));
+    
+    // Clear first: an edge from here on restarts the timer
+    uint32_t edgeMs = state.edgeMs;
+    state.edgePending = false;
+    
+    // Level unchanged: bounce back to the same state, or a glitch
+    bool pressed = digitalRead(state.pin) == LOW;
+    if (pressed == state.pressed) {
+        return;
+    }
+    state.pressed = pressed;
+    
+    if (pressed) {
+        state.longSent = false;
+        xTimerChangePeriod(state.holdTimer, pdMS_TO_TICKS(LONG_PRESS_DURATION), 0);
+        send(state, BUTTON_EVENT_PRESS, edgeMs);
+    } else {
+        xTimerStop(state.holdTimer, 0);
+        send(state, BUTTON_EVENT_RELEASE, edgeMs);
+        if (!state.longSent) {
+            send(state, BUTTON_EVENT_SHORT, edgeMs);
+        }
+    }
+}
+
+void DeviceButtons::onHold(TimerHandle_t timer) {
+    State& state = *static_cast<State*>(pvTimerGetTimerID(timer));
+    if (!state.pressed) {
+        return;
+    }
+    
+    if (!state.longSent) {
+        state.longSent = true;
+        xTimerChangePeriod(state.holdTimer, pdMS_TO_TICKS(BUTTON_REPEAT_MS), 0);
+        send(state, BUTTON_EVENT_LONG, millis());
+    } else {
+        send(state, BUTTON_EVENT_REPEAT, millis());
+    }
+}
+
+void DeviceButtons::send(const State& state, ButtonEventType type, uint32_t timeMs) {
+    ButtonEvent event = { state.button, (uint8_t)type, timeMs };
+    if (xQueueSend(queue, &event, 0) != pdTRUE) {
+        droppedEvents++;
+        return;
+    }
+    if (listener != nullptr) {
+        xTaskNotifyGive(listener);
+    }
+}
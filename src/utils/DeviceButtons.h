@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/timers.h>
+#include "../Config.h"
+
+// The M5StickC Plus2's own buttons
+enum DeviceButton : uint8_t {
+    DEVICE_BUTTON_A = 0,    // Front button (GPIO37)
+    DEVICE_BUTTON_B = 1,    // Side button (GPIO39)
+    DEVICE_BUTTON_COUNT = 2
+};
+
+enum ButtonEventType : uint8_t {
+    BUTTON_EVENT_PRESS,     // Debounced press, timed at its first edge
+    BUTTON_EVENT_RELEASE,   // Debounced release, timed at its first edge
+    BUTTON_EVENT_SHORT,     // Released before LONG_PRESS_DURATION
+    BUTTON_EVENT_LONG,      // Held for LONG_PRESS_DURATION
+    BUTTON_EVENT_REPEAT     // Still held, every BUTTON_REPEAT_MS after the long press
+};
+
+struct ButtonEvent {
+    uint8_t button;         // DeviceButton
+    uint8_t type;           // ButtonEventType
+    uint32_t timeMs;        // millis() of the edge, or of the hold timeout
+};
+
+// Interrupt-driven button input. An edge interrupt timestamps the change and
+// (re)starts a debounce timer; the timer reads the settled level and queues
+// typed events, and a hold timer adds the long press and repeats. Nothing
+// polls, so taps are not missed and press timing does not depend on a loop.
+class DeviceButtons {
+public:
+    // Attach the interrupts and create the timers and the event queue
+    static bool begin();
+    
+    // Task to notify whenever an event is queued
+    static void setListener(TaskHandle_t task);
+    
+    // Take the next event, false when there is none
+    static bool poll(ButtonEvent& event);
+    
+    // Events lost because the queue was full
+    static uint32_t getDroppedEvents();
+
+private:
+    struct State {
+        uint8_t button;
+        uint8_t pin;
+        volatile bool edgePending;      // An edge is waiting for the debounce timer
+        volatile uint32_t edgeMs;       // First edge since the last settled level
+        bool pressed;                   // Debounced level
+        bool longSent;                  // The current press already fired BUTTON_EVENT_LONG
+        TimerHandle_t debounceTimer;
+        TimerHandle_t holdTimer;
+    };
+    
+    static void IRAM_ATTR onEdge(void* arg);
+    static void onDebounce(TimerHandle_t timer);
+    static void onHold(TimerHandle_t timer);
+    static void send(const State& state, ButtonEventType type, uint32_t timeMs);
+    
+    static State states[DEVICE_BUTTON_COUNT];
+    static QueueHandle_t queue;
+    static TaskHandle_t listener;
+    static uint32_t droppedEvents;
+};
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "GestureEngine.h"
+
+// Index key of a layer, gesture type and button
+static inline int gestureKey(uint8_t layer, uint8_t type, uint8_t button) {
+    return (layer * GESTURE_TYPE_COUNT + type) * 32 + button;
+}
+
+// Whether the engine can index a table row
+static bool validBinding(const GestureBinding& binding) {
+    return binding.layer < GESTURE_LAYER_COUNT && binding.type < GESTURE_TYPE_COUNT &&
+           binding.button < 32 && (binding.type != GESTURE_CHORD || binding.button2 < 32);
+}
+
+GestureEngine::GestureEngine(const GestureBinding* bindings, uint8_t count, uint8_t shiftButton) :
+    bindings(bindings),
+    bindingCount(count),
+    shiftBit(1UL << shiftButton),
+    shiftBoundMask(0),
+    latchedMask(0) {
+    
+    memset(boundMask, 0, sizeof(boundMask));
+    memset(rangeStart, 0, sizeof(rangeStart));
+    
+    // Count the rows per key, and the buttons bound per layer and type
+    for (uint8_t i = 0; i < bindingCount; i++) {
+        const GestureBinding& binding = bindings[i];
+        if (!validBinding(binding)) {
+            continue;
+        }
+        
+        uint32_t bits = 1UL << binding.button;
+        rangeStart[gestureKey(binding.layer, binding.type, binding.button) + 1]++;
+        if (binding.type == GESTURE_CHORD && binding.button2 != binding.button) {
+            bits |= 1UL << binding.button2;
+            rangeStart[gestureKey(binding.layer, binding.type, binding.button2) + 1]++;
+        }
+        boundMask[binding.layer][binding.type] |= bits;
+        
+        if (binding.layer == GESTURE_LAYER_SHIFT) {
+            shiftBoundMask |= bits;
+        }
+    }
+    
+    // Counts to start offsets, then place the rows in table order
+    for (int key = 0; key < KEY_COUNT; key++) {
+        rangeStart[key + 1] += rangeStart[key];
+    }
+    uint8_t fill[KEY_COUNT];
+    memcpy(fill, rangeStart, sizeof(fill));
+    for (uint8_t i = 0; i < bindingCount; i++) {
+        const GestureBinding& binding = bindings[i];
+        if (!validBinding(binding)) {
+            continue;
+        }
+        
+        bindingIndex[fill[gestureKey(binding.layer, binding.type, binding.button)]++] = i;
+        if (binding.type == GESTURE_CHORD && binding.button2 != binding.button) {
+            bindingIndex[fill[gestureKey(binding.layer, binding.type, binding.button2)]++] = i;
+        }
+    }
+    
+    reset();
+}
+
+HOT_FUNC uint32_t GestureEngine::update(uint32_t heldMask, unsigned long currentTime) {
+    uint32_t changed = heldMask ^ previousMask;
+    uint32_t pressed = changed & heldMask;
+    uint32_t released = changed & ~heldMask;
+    previousMask = heldMask;
+    
+    uint8_t layer = (shiftBoundMask && (heldMask & shiftBit)) ? GESTURE_LAYER_SHIFT : GESTURE_LAYER_BASE;
+    
+    // Momentary actions end on release, in whichever layer they started
+    uint32_t edges = released & (boundMask[GESTURE_LAYER_BASE][GESTURE_PRESS] | boundMask[GESTURE_LAYER_SHIFT][GESTURE_PRESS]);
+    while (edges) {
+        int button = __builtin_ctz(edges);
+        edges &= edges - 1;
+        fire(GESTURE_PRESS, GESTURE_LAYER_BASE, button, false, heldMask, currentTime);
+        fire(GESTURE_PRESS, GESTURE_LAYER_SHIFT, button, false, heldMask, currentTime);
+    }
+    
+    capturedMask &= ~released;
+    pendingLongMask &= ~released;
+    longShiftMask &= ~released;
+    
+    // The shift button belongs to the gesture layer while it has bindings
+    if (layer == GESTURE_LAYER_SHIFT) {
+        capturedMask |= shiftBit;
+    }
+    
+    edges = pressed;
+    while (edges) {
+        int button = __builtin_ctz(edges);
+        uint32_t bit = 1UL << button;
+        edges &= edges - 1;
+        
+        // Buttons pressed in the shift layer stay hidden from the normal mapping
+        // until released, even if shift is let go first
+        if (layer == GESTURE_LAYER_SHIFT && (shiftBoundMask & bit)) {
+            capturedMask |= bit;
+        }
+        
+        if (boundMask[layer][GESTURE_PRESS] & bit) {
+            fire(GESTURE_PRESS, layer, button, true, heldMask, currentTime);
+        }
+        
+        if (boundMask[layer][GESTURE_DOUBLE_TAP] & bit) {
+            if (lastTapTime[button] && currentTime - lastTapTime[button] < DOUBLE_PRESS_TIME) {
+                fire(GESTURE_DOUBLE_TAP, layer, button, true, heldMask, currentTime);
+                lastTapTime[button] = 0;  // A third tap starts a new pair
+            } else {
+                lastTapTime[button] = currentTime ? currentTime : 1;
+            }
+        }
+        
+        if (boundMask[layer][GESTURE_CHORD] & bit) {
+            fire(GESTURE_CHORD, layer, button, true, heldMask, currentTime);
+        }
+        
+        if (boundMask[layer][GESTURE_LONG_PRESS] & bit) {
+            pendingLongMask |= bit;
+            if (layer == GESTURE_LAYER_SHIFT) {
+                longShiftMask |= bit;
+            }
+        }
+        
+        pressTime[button] = currentTime;
+    }
+    
+    // Long presses only need the few buttons still waiting
+    edges = pendingLongMask;
+    while (edges) {
+        int button = __builtin_ctz(edges);
+        uint32_t bit = 1UL << button;
+        edges &= edges - 1;
+        
+        if (currentTime - pressTime[button] >= LONG_PRESS_DURATION) {
+            pendingLongMask &= ~bit;
+            fire(GESTURE_LONG_PRESS, (longShiftMask & bit) ? GESTURE_LAYER_SHIFT : GESTURE_LAYER_BASE,
+                 button, true, heldMask, currentTime);
+        }
+    }
+    
+    return heldMask & ~capturedMask;
+}
+
+HOT_FUNC void GestureEngine::fire(uint8_t type, uint8_t layer, uint8_t button, bool pressed, uint32_t heldMask, unsigned long currentTime) {
+    int key = gestureKey(layer, type, button);
+    for (uint8_t i = rangeStart[key]; i < rangeStart[key + 1]; i++) {
+        const GestureBinding& binding = bindings[bindingIndex[i]];
+        
+        if (type == GESTURE_CHORD) {
+            // The new press completes the chord if the partner is held and was
+            // pressed within the window
+            uint8_t partner = (binding.button == button) ? binding.button2 : binding.button;
+            if (!(heldMask & (1UL << partner)) || currentTime - pressTime[partner] > GESTURE_CHORD_WINDOW_MS) {
+                continue;
+            }
+            capturedMask |= (1UL << button) | (1UL << partner);
+        }
+        
+        runAction(binding, pressed);
+    }
+}
+
+HOT_FUNC void GestureEngine::runAction(const GestureBinding& binding, bool pressed) {
+    if (binding.action == ACTION_CLEAR) {
+        if (pressed) {
+            latchedMask = 0;
+        }
+        return;
+    }
+    
+    if (binding.channel < 0 || binding.channel >= NUM_CHANNELS) {
+        return;
+    }
+    
+    uint16_t bit = 1U << binding.channel;
+    uint16_t onValue = binding.value ? binding.value : CHANNEL_VALUE_MAX;
+    
+    switch (binding.action) {
+        case ACTION_TOGGLE:
+            if (!pressed) break;
+            if (latchedMask & bit) {
+                latchedMask &= ~bit;
+            } else {
+                latchedMask |= bit;
+                latchedValue[binding.channel] = onValue;
+            }
+            break;
+        case ACTION_SET:
+            if (!pressed) break;
+            latchedMask |= bit;
+            latchedValue[binding.channel] = onValue;
+            break;
+        case ACTION_MOMENTARY:
+            if (pressed) {
+                latchedMask |= bit;
+                latchedValue[binding.channel] = CHANNEL_VALUE_MAX;
+            } else {
+                latchedMask &= ~bit;
+            }
+            break;
+        case ACTION_STEP: {
+            if (!pressed) break;
+            int value = (latchedMask & bit) ? latchedValue[binding.channel] : CHANNEL_VALUE_MID;
+            value = max(CHANNEL_VALUE_MIN, min(CHANNEL_VALUE_MAX, value + binding.value));
+            latchedMask |= bit;
+            latchedValue[binding.channel] = value;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+HOT_FUNC void GestureEngine::applyOverrides(ChannelManager* channelManager) const {
+    uint16_t mask = latchedMask;
+    while (mask) {
+        int channel = __builtin_ctz(mask);
+        mask &= mask - 1;
+        channelManager->setChannel(channel, latchedValue[channel]);
+    }
+}
+
+void GestureEngine::reset() {
+    previousMask = 0;
+    capturedMask = 0;
+    pendingLongMask = 0;
+    longShiftMask = 0;
+    latchedMask = 0;
+    for (int i = 0; i < 32; i++) {
+        pressTime[i] = 0;
+        lastTapTime[i] = 0;
+    }
+    for (int i = 0; i < NUM_CHANNELS; i++) {
+        latchedValue[i] = CHANNEL_VALUE_MID;
+    }
+}
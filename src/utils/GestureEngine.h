@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <Arduino.h>
+#include "../Config.h"
+#include "../channels/ChannelManager.h"
+
+// Gesture kinds recognised per button
+enum GestureType {
+    GESTURE_PRESS = 0,      // Press edge (and release, for momentary actions)
+    GESTURE_LONG_PRESS = 1, // Held for LONG_PRESS_DURATION
+    GESTURE_DOUBLE_TAP = 2, // Second press within DOUBLE_PRESS_TIME
+    GESTURE_CHORD = 3,      // button and button2 pressed within GESTURE_CHORD_WINDOW_MS
+    GESTURE_TYPE_COUNT = 4
+};
+
+// What a gesture does to its channel. Gesture channels are latched: they
+// override the normal mapping until released (toggled off, momentary release
+// or cleared), after which the normal mapping takes over again.
+enum GestureAction {
+    ACTION_TOGGLE = 0,    // Latch value (MAX if 0), or release if already latched
+    ACTION_SET = 1,       // Latch value
+    ACTION_MOMENTARY = 2, // Latch MAX while held (GESTURE_PRESS only)
+    ACTION_STEP = 3,      // Add value to the latched channel (starts at MID)
+    ACTION_CLEAR = 4      // Release every latched channel
+};
+
+// Layers: the shift button held selects GESTURE_LAYER_SHIFT
+#define GESTURE_LAYER_BASE 0
+#define GESTURE_LAYER_SHIFT 1
+#define GESTURE_LAYER_COUNT 2
+
+// One row of the gesture table
+struct GestureBinding {
+    uint8_t type;     // GestureType
+    uint8_t layer;    // GESTURE_LAYER_BASE or GESTURE_LAYER_SHIFT
+    uint8_t button;   // Button index (bit in the report mask)
+    uint8_t button2;  // Second button for GESTURE_CHORD
+    uint8_t action;   // GestureAction
+    int8_t channel;   // Target channel (ignored by ACTION_CLEAR)
+    int16_t value;    // Value for TOGGLE/SET, step for STEP
+};
+
+// Evaluates long press, double tap, chord and shift-layer gestures on report
+// timestamps. Work per report is proportional to the buttons with edges plus
+// buttons waiting for a long press; each of those visits only the bindings of
+// its own layer, gesture type and button, grouped once at construction.
+class GestureEngine {
+public:
+    // count must not exceed GESTURE_MAX_BINDINGS (checked where the table is defined)
+    GestureEngine(const GestureBinding* bindings, uint8_t count, uint8_t shiftButton);
+    
+    // Evaluate one report; returns the held mask left for the normal button mapping
+    uint32_t update(uint32_t heldMask, unsigned long currentTime);
+    
+    // Write latched gesture channels over the normal mapping
+    void applyOverrides(ChannelManager* channelManager) const;
+    
+    // Release all latches and forget button history
+    void reset();
+
+private:
+    // Run every binding of a type for a button (and its chord partner)
+    void fire(uint8_t type, uint8_t layer, uint8_t button, bool pressed, uint32_t heldMask, unsigned long currentTime);
+    void runAction(const GestureBinding& binding, bool pressed);
+    
+    const GestureBinding* bindings;
+    uint8_t bindingCount;
+    uint32_t shiftBit;
+    
+    // Buttons with at least one binding, per layer and gesture type
+    uint32_t boundMask[GESTURE_LAYER_COUNT][GESTURE_TYPE_COUNT];
+    uint32_t shiftBoundMask;  // Any binding in the shift layer
+    
+    // Table rows grouped by (layer, type, button), in table order; a chord is
+    // listed under both of its buttons. Rows of key k are
+    // bindingIndex[rangeStart[k]] up to bindingIndex[rangeStart[k + 1]]
+    static const int KEY_COUNT = GESTURE_LAYER_COUNT * GESTURE_TYPE_COUNT * 32;
+    uint8_t rangeStart[KEY_COUNT + 1];
+    uint8_t bindingIndex[2 * GESTURE_MAX_BINDINGS];
+    
+    uint32_t previousMask;
+    uint32_t capturedMask;    // Held buttons hidden from the normal mapping
+    uint32_t pendingLongMask; // Held buttons waiting for a long press
+    uint32_t longShiftMask;   // Pending long presses that started in the shift layer
+    unsigned long pressTime[32];
+    unsigned long lastTapTime[32];
+    
+    uint16_t latchedMask;
+    uint16_t latchedValue[NUM_CHANNELS];
+};
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Log.h"
+
+static const char* const moduleNames[LOG_MODULE_COUNT] = {
+    "main", "input", "crsf", "display", "connect", "recorder", "replay"
+};
+
+static const char levelChars[] = { '-', 'E', 'W', 'I', 'D' };
+
+// All state is constant- or zero-initialised, so logging works from any
+// constructor or task before begin() is called
+uint8_t Log::levels[LOG_MODULE_COUNT] = {
+    LOG_LEVEL, LOG_LEVEL, LOG_LEVEL, LOG_LEVEL, LOG_LEVEL, LOG_LEVEL, LOG_LEVEL
+};
+LogRecord Log::ring[LOG_RING_SIZE];
+std::atomic<uint32_t> Log::head(0);
+uint32_t Log::tail = 0;
+std::atomic<uint32_t> Log::dropped(0);
+TaskHandle_t Log::drainTaskHandle = nullptr;
+
+bool Log::begin() {
+    if (drainTaskHandle != nullptr) {
+        return true;
+    }
+    
+    // Low priority on core 0, waiting on the UART never delays input or RF work
+    BaseType_t created = xTaskCreatePinnedToCore(drainTaskEntry, "log", 3072, nullptr, 1, &drainTaskHandle, 0);
+    if (created != pdPASS) {
+        drainTaskHandle = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void Log::setLevel(LogModule module, uint8_t level) {
+    if (module < LOG_MODULE_COUNT) {
+        levels[module] = min((uint8_t)LOG_LEVEL, level);
+    }
+}
+
+uint8_t Log::getLevel(LogModule module) {
+    return module < LOG_MODULE_COUNT ? levels[module] : LOG_LEVEL_NONE;
+}
+
+uint32_t Log::getDropped() {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+// Bounded multi-producer ring: each slot carries a sequence number, stored
+// relative to its index so the zeroed ring starts out free. A slot is free for
+// position p when its sequence equals p and readable when it equals p + 1.
+LogRecord* Log::claim() {
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    
+    while (true) {
+        LogRecord* record = &ring[pos % LOG_RING_SIZE];
+        uint32_t sequence = record->sequence.load(std::memory_order_acquire) + (pos % LOG_RING_SIZE);
+        int32_t diff = (int32_t)(sequence - pos);
+        
+        if (diff == 0) {
+            if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return record;
+            }
+        } else if (diff < 0) {
+            // Drain task is a full lap behind
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            pos = head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Log::publish(LogRecord* record) {
+    uint32_t index = record - ring;
+    uint32_t pos = record->sequence.load(std::memory_order_relaxed) + index;
+    record->sequence.store(pos + 1 - index, std::memory_order_release);
+}
+
+void Log::packArg(LogRecord* record, int index, const char* value) {
+    // Strings are packed back to back; whatever does not fit is cut short
+    uint8_t used = record->stringUsed;
+    uint8_t space = LOG_STRING_SIZE - used;
+    record->args[index] = used;
+    record->stringMask |= (1 << index);
+    
+    if (space == 0) {
+        record->args[index] = LOG_STRING_SIZE - 1;
+        return;
+    }
+    
+    if (value == nullptr) {
+        value = "(null)";
+    }
+    size_t length = strnlen(value, space - 1);
+    memcpy(record->text + used, value, length);
+    record->text[used + length] = '\0';
+    record->stringUsed = used + length + 1;
+}
+
+bool Log::drainOne() {
+    LogRecord* record = &ring[tail % LOG_RING_SIZE];
+    uint32_t index = tail % LOG_RING_SIZE;
+    uint32_t sequence = record->sequence.load(std::memory_order_acquire) + index;
+    if (sequence != tail + 1) {
+        return false;
+    }
+    
+    // Copy out so the slot can be reused while the UART is busy
+    LogRecord copy;
+    copy.timeMs = record->timeMs;
+    copy.format = record->format;
+    copy.level = record->level;
+    copy.module = record->module;
+    copy.stringMask = record->stringMask;
+    memcpy(copy.args, record->args, sizeof(copy.args));
+    memcpy(copy.text, record->text, sizeof(copy.text));
+    copy.text[LOG_STRING_SIZE - 1] = '\0';
+    
+    record->sequence.store(tail + LOG_RING_SIZE - index, std::memory_order_release);
+    tail++;
+    
+    // Replace string offsets with pointers into the copy (32-bit pointers on the ESP32)
+    uint32_t args[LOG_MAX_ARGS];
+    for (int i = 0; i < LOG_MAX_ARGS; i++) {
+        args[i] = (copy.stringMask & (1 << i)) ? (uint32_t)(uintptr_t)(copy.text + copy.args[i]) : copy.args[i];
+    }
+    
+    char line[128];
+    snprintf(line, sizeof(line), copy.format, args[0], args[1], args[2], args[3]);
+    Serial.printf("%7lu %c %-8s %s\n", (unsigned long)copy.timeMs,
+                  levelChars[copy.level < sizeof(levelChars) ? copy.level : 0],
+                  moduleNames[copy.module < LOG_MODULE_COUNT ? copy.module : 0], line);
+    return true;
+}
+
+void Log::drainTaskEntry(void* param) {
+    uint32_t reportedDropped = 0;
+    
+    while (true) {
+        while (drainOne()) {
+        }
+        
+        uint32_t lost = getDropped();
+        if (lost != reportedDropped) {
+            Serial.printf("%7lu W log      %u records dropped\n", millis(), (unsigned)(lost - reportedDropped));
+            reportedDropped = lost;
+        }
+        
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL_MS));
+    }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+
+// Log levels, lower is more important
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#include "../Config.h"
+
+// Modules with their own runtime level
+enum LogModule {
+    LOG_MAIN = 0,
+    LOG_INPUT,
+    LOG_CRSF,
+    LOG_DISPLAY,
+    LOG_CONNECT,
+    LOG_RECORDER,
+    LOG_REPLAY,
+    LOG_MODULE_COUNT
+};
+
+#define LOG_MAX_ARGS 4
+
+// One binary log record. The format string pointer doubles as the message ID:
+// only literals may be used, and they are formatted on the drain task. String
+// arguments are copied into the record so callers may pass temporaries.
+struct LogRecord {
+    std::atomic<uint32_t> sequence;  // Ring slot ownership
+    uint32_t timeMs;
+    const char* format;
+    uint8_t level;
+    uint8_t module;
+    uint8_t stringMask;              // Bit per argument that is a string
+    uint8_t stringUsed;              // Bytes used in text
+    uint32_t args[LOG_MAX_ARGS];
+    char text[LOG_STRING_SIZE];      // NUL-separated copies of string arguments
+};
+
+// Deferred logger. Producers on any task claim a slot in a lock-free ring and
+// never touch the UART; a low-priority task formats and prints the records.
+// When the ring is full the record is dropped and counted instead of blocking.
+class Log {
+public:
+    // Start the drain task (records written earlier wait in the ring)
+    static bool begin();
+    
+    // Runtime level per module, capped by the compile-time LOG_LEVEL
+    static void setLevel(LogModule module, uint8_t level);
+    static uint8_t getLevel(LogModule module);
+    
+    // Records lost because the ring was full
+    static uint32_t getDropped();
+    
+    template<typename... Args>
+    static void write(uint8_t level, LogModule module, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+        if (level > levels[module]) {
+            return;
+        }
+        
+        LogRecord* record = claim();
+        if (record == nullptr) {
+            return;
+        }
+        
+        record->timeMs = millis();
+        record->format = format;
+        record->level = level;
+        record->module = module;
+        record->stringMask = 0;
+        record->stringUsed = 0;
+        pack(record, 0, args...);
+        publish(record);
+    }
+
+private:
+    static LogRecord* claim();
+    static void publish(LogRecord* record);
+    static bool drainOne();
+    static void drainTaskEntry(void* param);
+    
+    // Argument packing: integers are stored as 32-bit words, strings are copied
+    static void pack(LogRecord* record, int index) {
+        (void)record;
+        (void)index;
+    }
+    
+    template<typename T, typename... Rest>
+    static void pack(LogRecord* record, int index, T value, Rest... rest) {
+        packArg(record, index, value);
+        pack(record, index + 1, rest...);
+    }
+    
+    template<typename T>
+    static void packArg(LogRecord* record, int index, T value) {
+        static_assert(!std::is_floating_point<T>::value, "log records do not carry floats");
+        static_assert(sizeof(T) <= sizeof(uint32_t), "log records carry 32-bit arguments");
+        record->args[index] = (uint32_t)value;
+    }
+    
+    static void packArg(LogRecord* record, int index, const char* value);
+    static void packArg(LogRecord* record, int index, char* value) {
+        packArg(record, index, (const char*)value);
+    }
+    
+    static uint8_t levels[LOG_MODULE_COUNT];
+    static LogRecord ring[LOG_RING_SIZE];
+    static std::atomic<uint32_t> head;
+    static uint32_t tail;
+    static std::atomic<uint32_t> dropped;
+    static TaskHandle_t drainTaskHandle;
+};
+
+// Calls below the compile-time level vanish, arguments included
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(module, ...) Log::write(LOG_LEVEL_ERROR, module, __VA_ARGS__)
+#else
+#define LOG_E(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(module, ...) Log::write(LOG_LEVEL_WARN, module, __VA_ARGS__)
+#else
+#define LOG_W(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(module, ...) Log::write(LOG_LEVEL_INFO, module, __VA_ARGS__)
+#else
+#define LOG_I(module, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(module, ...) Log::write(LOG_LEVEL_DEBUG, module, __VA_ARGS__)
+#else
+#define LOG_D(module, ...) do {} while (0)
+#endif
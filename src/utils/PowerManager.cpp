@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "PowerManager.h"
+#include "Log.h"
+
+static const char* const modeNames[] = { "performance", "dynamic frequency", "light sleep" };
+
+uint8_t PowerManager::mode = POWER_MODE_PERFORMANCE;
+esp_pm_lock_handle_t PowerManager::maxFrequencyLock = nullptr;
+bool PowerManager::locked = false;
+uint32_t PowerManager::lockedSince = 0;
+uint32_t PowerManager::lockedUs = 0;
+uint32_t PowerManager::statsSince = 0;
+
+bool PowerManager::begin() {
+    statsSince = micros();
+    
+#if POWER_MODE != POWER_MODE_PERFORMANCE
+    // Fails when the framework was built without CONFIG_PM_ENABLE
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "loop", &maxFrequencyLock) != ESP_OK) {
+        LOG_W(LOG_MAIN, "Power management not available, CPU stays at %d MHz", ESP.getCpuFreqMHz());
+        maxFrequencyLock = nullptr;
+        return false;
+    }
+    
+    // Light sleep needs the tick to stop while idle. Bluetooth still keeps the
+    // chip awake while its radio is enabled, unless it has a 32kHz crystal
+    bool lightSleep = POWER_MODE == POWER_MODE_LIGHT_SLEEP;
+#ifndef CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    if (lightSleep) {
+        LOG_W(LOG_MAIN, "Light sleep needs tickless idle in sdkconfig, scaling the clock only");
+        lightSleep = false;
+    }
+#endif
+    
+    // The caller is in its work window until it unlocks
+    lockMaxFrequency();
+    
+    esp_pm_config_esp32_t config = { POWER_MAX_FREQ_MHZ, POWER_MIN_FREQ_MHZ, lightSleep };
+    esp_err_t result = esp_pm_configure(&config);
+    if (result != ESP_OK) {
+        LOG_W(LOG_MAIN, "esp_pm_configure failed (%d), CPU stays at full clock", result);
+        unlockMaxFrequency();
+        esp_pm_lock_delete(maxFrequencyLock);
+        maxFrequencyLock = nullptr;
+        return false;
+    }
+    mode = lightSleep ? POWER_MODE_LIGHT_SLEEP : POWER_MODE_DFS;
+#endif
+    
+    LOG_I(LOG_MAIN, "Power mode: %s, %d-%d MHz", modeNames[mode],
+          mode == POWER_MODE_PERFORMANCE ? ESP.getCpuFreqMHz() : POWER_MIN_FREQ_MHZ, ESP.getCpuFreqMHz());
+    return true;
+}
+
+void PowerManager::lockMaxFrequency() {
+    if (maxFrequencyLock == nullptr || locked) {
+        return;
+    }
+    
+    // Switches the clock up before returning
+    esp_pm_lock_acquire(maxFrequencyLock);
+    locked = true;
+    lockedSince = micros();
+}
+
+void PowerManager::unlockMaxFrequency() {
+    if (maxFrequencyLock == nullptr || !locked) {
+        return;
+    }
+    
+    lockedUs += micros() - lockedSince;
+    locked = false;
+    esp_pm_lock_release(maxFrequencyLock);
+}
+
+uint8_t PowerManager::getMode() {
+    return mode;
+}
+
+void PowerManager::logStats() {
+    uint32_t now = micros();
+    uint32_t elapsed = now - statsSince;
+    
+    if (mode != POWER_MODE_PERFORMANCE && elapsed > 0) {
+        uint32_t permille = (uint32_t)((uint64_t)lockedUs * 1000 / elapsed);
+        LOG_I(LOG_MAIN, "power: %s, full clock %lu.%lu%% of the time",
+              modeNames[mode], (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+    }
+    lockedUs = 0;
+    statsSince = now;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <esp_pm.h>
+#include "../Config.h"
+
+// CPU clock and sleep policy. With POWER_MODE_DFS or POWER_MODE_LIGHT_SLEEP,
+// esp_pm lowers the clock (or sleeps) whenever no task holds a lock. The loop
+// holds the max-frequency lock for its work window once per CRSF frame, so the
+// bit-banged frame and the input mapping always run at full clock. Bluetooth
+// keeps its own locks while the radio needs them.
+class PowerManager {
+public:
+    // Configure esp_pm for POWER_MODE; stays at full clock when the framework
+    // was built without power management
+    static bool begin();
+    
+    // Hold the CPU at POWER_MAX_FREQ_MHZ (loop task)
+    static void lockMaxFrequency();
+    static void unlockMaxFrequency();
+    
+    // Mode in effect, which may be lower than POWER_MODE
+    static uint8_t getMode();
+    
+    // Log the mode and the share of time the lock was held since the last call
+    static void logStats();
+
+private:
+    static uint8_t mode;
+    static esp_pm_lock_handle_t maxFrequencyLock;
+    static bool locked;
+    static uint32_t lockedSince;     // micros() when the lock was taken
+    static uint32_t lockedUs;        // Held time since the last stats line
+    static uint32_t statsSince;
+};
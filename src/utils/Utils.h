@@ -29,4 +29,10 @@
 int mapValueClamped(int value, int from_min, int from_max, int to_min, int to_max);
 
 // CRC8-DVB-S2 as used in the CRSF protocol
-uint8_t crcCRSF(const uint8_t *buf, uint8_t len); 
\ No newline at end of file
+uint8_t crcCRSF(const uint8_t *buf, uint8_t len); 
+
+// CRC-32 (IEEE 802.3), for stored data
+uint32_t crc32(const uint8_t *buf, size_t len);
+
+// Parse a MAC address "xx:xx:xx:xx:xx:xx" (either case), false if malformed
+bool parseMac(const char* text, uint8_t mac[6]);
\ No newline at end of file
@@ -0,0 +1,40 @@
+#
+# Copyright (c) 2024 CrossTieConnect
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# PlatformIO pre-build step: regenerate src/logo_rle.h when the logo PNG
+# (embedded in src/logo.h) is newer. The generated header is committed, so
+# builds work without this step as well.
+
+import os
+import sys
+
+Import("env")
+
+project = env.subst("$PROJECT_DIR")
+sys.path.insert(0, os.path.join(project, "tools", "logo"))
+import png2rle
+
+source = os.path.join(project, "src", "logo.h")
+output = os.path.join(project, "src", "logo_rle.h")
+
+if not os.path.exists(output) or os.path.getmtime(source) > os.path.getmtime(output):
+    width, height, size, png_size = png2rle.convert(source, output)
+    print("Logo: %dx%d, %d bytes RLE (PNG %d bytes)" % (width, height, size, png_size))
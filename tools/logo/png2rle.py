@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 CrossTieConnect
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Convert a PNG to the run-length encoded RGB565 image LogoScreen streams.
+
+The PNG is read from a .png file or from the byte array of a C header such as
+src/logo.h. Transparent pixels are blended over black, the panel background.
+
+Encoding, in 16-bit words: a word with the top bit set starts a run of
+(word & 0x7FFF) copies of the next word; otherwise it is followed by that many
+literal pixels. Pixels are RGB565 with the bytes swapped (lgfx::swap565_t), so
+they go to the panel as they are. Runs may continue across rows.
+
+Usage: png2rle.py <input.png|input.h> <output.h> [symbol]
+"""
+
+import re
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+MAX_COUNT = 0x7FFF
+
+LICENSE = """/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+"""
+
+
+def read_png_bytes(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data.startswith(PNG_SIGNATURE):
+        return data
+    # C header: take the first brace-enclosed list of hex bytes
+    text = data.decode("ascii", "replace")
+    body = re.search(r"\{([^}]*)\}", text)
+    if body is None:
+        raise ValueError("%s: no PNG data found" % path)
+    return bytes(int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]{2})", body.group(1)))
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def decode_png(data):
+    """Return (width, height, rows of RGBA tuples) for 8-bit non-interlaced PNGs."""
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("not a PNG")
+    pos = len(PNG_SIGNATURE)
+    header = None
+    palette = []
+    alphas = b""
+    compressed = bytearray()
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            alphas = chunk
+        elif kind == b"IDAT":
+            compressed += chunk
+        elif kind == b"IEND":
+            break
+
+    width, height, depth, color_type, _, _, interlace = header
+    if depth != 8 or interlace != 0 or color_type not in CHANNELS:
+        raise ValueError("only 8-bit non-interlaced PNGs are supported")
+    channels = CHANNELS[color_type]
+    stride = width * channels
+    raw = zlib.decompress(bytes(compressed))
+
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        offset = y * (stride + 1)
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = previous[i]
+            corner = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                line[i] = (line[i] + paeth(left, up, corner)) & 0xFF
+        previous = line
+
+        pixels = []
+        for x in range(width):
+            p = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                pixels.append((p[0], p[0], p[0], 255))
+            elif color_type == 2:
+                pixels.append((p[0], p[1], p[2], 255))
+            elif color_type == 3:
+                r, g, b = palette[p[0]]
+                pixels.append((r, g, b, alphas[p[0]] if p[0] < len(alphas) else 255))
+            elif color_type == 4:
+                pixels.append((p[0], p[0], p[0], p[1]))
+            else:
+                pixels.append(tuple(p))
+        rows.append(pixels)
+    return width, height, rows
+
+
+def to_swap565(pixel):
+    r, g, b, a = pixel
+    r, g, b = (r * a + 127) // 255, (g * a + 127) // 255, (b * a + 127) // 255
+    value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return ((value & 0xFF) << 8) | (value >> 8)
+
+
+def encode_rle(pixels):
+    words = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            part = literals[:MAX_COUNT]
+            del literals[:MAX_COUNT]
+            words.append(len(part))
+            words.extend(part)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < MAX_COUNT:
+            run += 1
+        # Runs of two cost as much as literals, keep them literal
+        if run >= 3:
+            flush_literals()
+            words.append(0x8000 | run)
+            words.append(pixels[i])
+        else:
+            literals.extend(pixels[i:i + run])
+        i += run
+    flush_literals()
+    return words
+
+
+def write_header(path, symbol, width, height, words, source_name, png_size):
+    macro = symbol.upper()
+    with open(path, "w") as f:
+        f.write(LICENSE)
+        f.write("\n")
+        f.write("// Generated by tools/logo/png2rle.py from %s, do not edit.\n" % source_name)
+        f.write("// %dx%d, %d bytes (the PNG is %d bytes); format in png2rle.py.\n\n"
+                % (width, height, len(words) * 2, png_size))
+        f.write("#pragma once\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("#define %s_WIDTH %d\n" % (macro, width))
+        f.write("#define %s_HEIGHT %d\n\n" % (macro, height))
+        f.write("static const uint16_t %s[] = {\n" % symbol)
+        for i in range(0, len(words), 12):
+            f.write("  " + ", ".join("0x%04x" % w for w in words[i:i + 12]) + ",\n")
+        f.write("};\n")
+        f.write("static const unsigned int %s_len = %d;\n" % (symbol, len(words)))
+
+
+def convert(source, output, symbol="logo_rle"):
+    png = read_png_bytes(source)
+    width, height, rows = decode_png(png)
+    pixels = [to_swap565(p) for row in rows for p in row]
+    words = encode_rle(pixels)
+    write_header(output, symbol, width, height, words, source.replace("\\", "/").split("/")[-1], len(png))
+    return width, height, len(words) * 2, len(png)
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.stderr.write(__doc__)
+        return 2
+    width, height, size, png_size = convert(argv[1], argv[2], argv[3] if len(argv) > 3 else "logo_rle")
+    print("%s: %dx%d, %d bytes RLE (PNG %d bytes)" % (argv[2], width, height, size, png_size))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Host-side decoder for flight recordings written by FlightRecorder.
+// Expands a rec_NNNN.bin file from the LittleFS partition into CSV.
+//
+// Build:  g++ -std=c++11 -O2 -I../../src -o flight_decode flight_decode.cpp
+// Usage:  ./flight_decode rec_0003.bin > rec_0003.csv
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "recorder/RecordFormat.h"
+
+static bool readFile(const char* path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+    fclose(file);
+    return true;
+}
+
+static void printRow(uint32_t seq, uint32_t timeMs, bool linkUp, const uint16_t* channels) {
+    printf("%u,%u,%d", seq, timeMs, linkUp ? 1 : 0);
+    for (int i = 0; i < RECORD_CHANNELS; i++) {
+        printf(",%u", channels[i]);
+    }
+    printf("\n");
+}
+
+// Decode one block, returns the number of frames emitted
+static int decodeBlock(const uint8_t* block, size_t blockSize) {
+    RecordBlockHeader header;
+    memcpy(&header, block, sizeof(header));
+    
+    if (header.used < sizeof(RecordBlockHeader) || header.used > blockSize) {
+        fprintf(stderr, "block %u: invalid length %u, skipped\n", header.seq, header.used);
+        return 0;
+    }
+    
+    uint16_t channels[RECORD_CHANNELS];
+    memcpy(channels, header.keyframe, sizeof(channels));
+    uint32_t timeMs = header.baseTimeMs;
+    bool linkUp = header.linkUp != 0;
+    printRow(header.seq, timeMs, linkUp, channels);
+    int frames = 1;
+    
+    size_t pos = sizeof(RecordBlockHeader);
+    while (pos < header.used) {
+        uint32_t delta, mask, value;
+        size_t n = recordGetVarint(&block[pos], header.used - pos, &delta);
+        if (n == 0) break;
+        pos += n;
+        
+        n = recordGetVarint(&block[pos], header.used - pos, &mask);
+        if (n == 0) break;
+        pos += n;
+        
+        timeMs += delta;
+        if (mask & RECORD_MASK_LINK) {
+            linkUp = !linkUp;
+        }
+        
+        bool truncated = false;
+        for (int i = 0; i < RECORD_CHANNELS; i++) {
+            if (mask & (1UL << i)) {
+                n = recordGetVarint(&block[pos], header.used - pos, &value);
+                if (n == 0) {
+                    truncated = true;
+                    break;
+                }
+                pos += n;
+                channels[i] = (uint16_t)(channels[i] + recordUnzigzag(value));
+            }
+        }
+        if (truncated) break;
+        
+        printRow(header.seq, timeMs, linkUp, channels);
+        frames++;
+    }
+    
+    if (frames != header.frameCount) {
+        fprintf(stderr, "block %u: expected %u frames, decoded %d\n", header.seq, header.frameCount, frames);
+    }
+    return frames;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <recording.bin>\n", argv[0]);
+        return 2;
+    }
+    
+    std::vector<uint8_t> data;
+    if (!readFile(argv[1], data)) {
+        fprintf(stderr, "cannot read %s\n", argv[1]);
+        return 1;
+    }
+    
+    RecordFileHeader fileHeader;
+    if (data.size() < sizeof(fileHeader)) {
+        fprintf(stderr, "%s: file too short\n", argv[1]);
+        return 1;
+    }
+    memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+    
+    if (fileHeader.magic != RECORD_FILE_MAGIC || fileHeader.version != RECORD_FILE_VERSION ||
+        fileHeader.channelCount != RECORD_CHANNELS || fileHeader.blockSize < sizeof(RecordBlockHeader)) {
+        fprintf(stderr, "%s: not a flight recording (or unsupported version)\n", argv[1]);
+        return 1;
+    }
+    
+    fprintf(stderr, "trigger: %s at block %u\n",
+            fileHeader.reason == TRIGGER_LINK_LOSS ? "link loss" : "manual", fileHeader.triggerSeq);
+    
+    printf("block,time_ms,link");
+    for (int i = 0; i < RECORD_CHANNELS; i++) {
+        printf(",ch%d", i);
+    }
+    printf("\n");
+    
+    int blocks = 0;
+    int frames = 0;
+    for (size_t pos = sizeof(fileHeader); pos + fileHeader.blockSize <= data.size(); pos += fileHeader.blockSize) {
+        frames += decodeBlock(&data[pos], fileHeader.blockSize);
+        blocks++;
+    }
+    
+    fprintf(stderr, "decoded %d frames from %d blocks\n", frames, blocks);
+    return 0;
+}
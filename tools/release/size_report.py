@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 CrossTieConnect
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+"""Compare the size and CRSF frame timing of two firmware builds.
+
+Sizes come from the ELF section headers of each build's firmware.elf, so no
+toolchain is needed: IRAM and DRAM use against the ESP32 limits, flash code
+and constants, and the project symbols that ended up in IRAM.
+
+Timing comes from serial logs of each build running on the device, from the
+CRSF line logged every CRSF_STATS_INTERVAL_MS ("N frames, build ... ns avg /
+... ns max, send ... us max"). The release build compiles info lines out; to
+log timing from it, build it with LOG_LEVEL raised, for example
+  PLATFORMIO_BUILD_FLAGS="-DLOG_LEVEL=3" pio run -e esp32-release -t upload
+
+Usage (from the repository root, after pio run -e esp32 -e esp32-release):
+  size_report.py [--envs esp32 esp32-release] [--timing debug.log release.log]
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+# Section name prefixes per memory region (ESP-IDF linker script names)
+REGIONS = [
+    ("IRAM", (".iram0.vectors", ".iram0.text")),
+    ("DRAM data", (".dram0.data",)),
+    ("DRAM bss", (".dram0.bss", ".noinit")),
+    ("Flash code", (".flash.text",)),
+    ("Flash rodata", (".flash.rodata", ".flash.appdesc")),
+]
+
+# Internal RAM available to the application on the ESP32
+IRAM_LIMIT = 128 * 1024
+DRAM_LIMIT = 180 * 1024
+
+# Mangled-name fragments of the functions the release build moves to IRAM
+HOT_SYMBOLS = ("CRSFModule", "crcCRSF", "packRcChannels", "buildRcChannelsFrame",
+               "mapValueClamped", "PS5InputMapper", "ButtonEngine", "GestureEngine",
+               "ChannelManager")
+
+STATS_LINE = re.compile(r"(\d+) frames, build (\d+) ns avg / (\d+) ns max, send (\d+) us max")
+
+
+def read_sections(path):
+    """Return ({section name: (address, size)}, [(symbol, section name, size)])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise ValueError("%s is not a 32-bit ELF file" % path)
+
+    shoff, = struct.unpack_from("<I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+    headers = [struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize) for i in range(shnum)]
+
+    def string(table, offset):
+        start = headers[table][4] + offset
+        return data[start:data.index(b"\0", start)].decode("ascii", "replace")
+
+    names = [string(shstrndx, h[0]) for h in headers]
+    sections = {names[i]: (h[3], h[5]) for i, h in enumerate(headers) if names[i]}
+
+    symbols = []
+    for h in headers:
+        if h[1] != 2:  # SHT_SYMTAB
+            continue
+        for offset in range(h[4], h[4] + h[5], 16):
+            name, value, size, info, other, index = struct.unpack_from("<IIIBBH", data, offset)
+            if (info & 0xF) == 2 and 0 < index < shnum:  # STT_FUNC
+                symbols.append((string(h[6], name), names[index], size))
+    return sections, symbols
+
+
+def region_sizes(sections):
+    sizes = {}
+    for region, prefixes in REGIONS:
+        sizes[region] = sum(size for name, (_, size) in sections.items() if name.startswith(prefixes))
+    return sizes
+
+
+def size_report(envs):
+    builds = []
+    for env in envs:
+        path = os.path.join(".pio", "build", env, "firmware.elf")
+        if not os.path.exists(path):
+            sys.exit("%s not found, run: pio run -e %s" % (path, env))
+        sections, symbols = read_sections(path)
+        builds.append((env, region_sizes(sections), symbols))
+
+    print("%-14s" % "bytes" + "".join("%16s" % env for env, _, _ in builds) + "%12s" % "delta")
+    for region, _ in REGIONS:
+        values = [sizes[region] for _, sizes, _ in builds]
+        print("%-14s" % region + "".join("%16d" % v for v in values) + "%+12d" % (values[-1] - values[0]))
+
+    for env, sizes, _ in builds:
+        dram = sizes["DRAM data"] + sizes["DRAM bss"]
+        print("%s: IRAM %.1f%% of %d KB, DRAM %.1f%% of %d KB" % (
+            env, 100.0 * sizes["IRAM"] / IRAM_LIMIT, IRAM_LIMIT // 1024,
+            100.0 * dram / DRAM_LIMIT, DRAM_LIMIT // 1024))
+
+    for env, _, symbols in builds:
+        hot = sorted((size, name) for name, section, size in symbols
+                     if section.startswith(".iram0") and any(s in name for s in HOT_SYMBOLS))
+        print("\n%s: %d project functions in IRAM, %d bytes" % (env, len(hot), sum(s for s, _ in hot)))
+        for size, name in reversed(hot):
+            print("  %6d  %s" % (size, name))
+
+
+def read_timing(path):
+    """Frame-weighted build average and the worst build and send times of a log."""
+    frames = build_total = build_max = send_max = 0
+    with open(path, errors="replace") as f:
+        for line in f:
+            match = STATS_LINE.search(line)
+            if match:
+                count, avg, worst, send = (int(v) for v in match.groups())
+                frames += count
+                build_total += count * avg
+                build_max = max(build_max, worst)
+                send_max = max(send_max, send)
+    if frames == 0:
+        sys.exit("%s has no CRSF timing lines" % path)
+    return frames, build_total // frames, build_max, send_max
+
+
+def timing_report(paths):
+    print("\n%-34s%10s%16s%16s%16s" % ("log", "frames", "build avg ns", "build max ns", "send max us"))
+    for path in paths:
+        print("%-34s%10d%16d%16d%16d" % ((os.path.basename(path),) + read_timing(path)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--envs", nargs="+", default=["esp32", "esp32-release"],
+                        help="PlatformIO environments to compare, the first is the baseline")
+    parser.add_argument("--timing", nargs="+", metavar="LOG",
+                        help="serial logs of the builds, in the same order")
+    args = parser.parse_args()
+
+    size_report(args.envs)
+    if args.timing:
+        timing_report(args.timing)
+
+
+if __name__ == "__main__":
+    main()
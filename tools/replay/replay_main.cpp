@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 CrossTieConnect
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Host build of the replay engine: runs a DualSense input trace through the
+// firmware's mapping and CRSF packing and prints a digest of the frames, so
+// mapping changes can be regression-tested and benchmarked off-device.
+//
+// Build (from the repository root), with these sources on one command line:
+//   g++ -std=c++11 -O2 -Itools/replay/host -Isrc -o replay
+//       tools/replay/replay_main.cpp
+//       src/replay/ReplayEngine.cpp src/replay/TraceFormat.cpp
+//       src/controllers/PS5InputMapper.cpp src/utils/ButtonEngine.cpp
+//       src/utils/GestureEngine.cpp
+//       src/channels/ChannelManager.cpp src/crsf/CRSFFrame.cpp src/utils/Utils.cpp
+//
+// Usage:
+//   ./replay trace.csv                  replay a recorded trace
+//   ./replay --synthetic 100000         replay a generated trace
+//   options: --frames out.bin           write every CRSF frame
+//            --dump-trace out.csv       write the trace that was replayed
+//            --repeat N                 run N times and report the best time
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "replay/ReplayEngine.h"
+#include "replay/TraceFormat.h"
+
+static bool loadTrace(const char* path, std::vector<PS5Report>& reports) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+    
+    char line[256];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        PS5Report report;
+        if (parseTraceLine(line, report)) {
+            reports.push_back(report);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+static void writeFrame(const uint8_t* frame, size_t length, void* context) {
+    fwrite(frame, 1, length, static_cast<FILE*>(context));
+}
+
+int main(int argc, char** argv) {
+    const char* tracePath = nullptr;
+    const char* framesPath = nullptr;
+    const char* dumpPath = nullptr;
+    long synthetic = 0;
+    int repeat = 1;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--synthetic") == 0 && i + 1 < argc) {
+            synthetic = strtol(argv[++i], nullptr, 0);
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            framesPath = argv[++i];
+        } else if (strcmp(argv[i], "--dump-trace") == 0 && i + 1 < argc) {
+            dumpPath = argv[++i];
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = atoi(argv[++i]);
+        } else if (argv[i][0] != '-') {
+            tracePath = argv[i];
+        } else {
+            fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+    
+    std::vector<PS5Report> reports;
+    if (tracePath != nullptr) {
+        if (!loadTrace(tracePath, reports)) {
+            fprintf(stderr, "cannot read %s\n", tracePath);
+            return 1;
+        }
+    } else if (synthetic > 0) {
+        reports.resize(synthetic);
+        synthesizeTrace(reports.data(), reports.size(), 1, 4);
+    } else {
+        fprintf(stderr, "usage: %s <trace.csv> | --synthetic N [--frames out.bin] [--dump-trace out.csv] [--repeat N]\n", argv[0]);
+        return 2;
+    }
+    
+    if (dumpPath != nullptr) {
+        FILE* dump = fopen(dumpPath, "w");
+        if (dump == nullptr) {
+            fprintf(stderr, "cannot write %s\n", dumpPath);
+            return 1;
+        }
+        fprintf(dump, "# time_ms,left_x,left_y,right_x,right_y,l2,r2,buttons\n");
+        char line[64];
+        for (const PS5Report& report : reports) {
+            formatTraceLine(line, sizeof(line), report);
+            fprintf(dump, "%s\n", line);
+        }
+        fclose(dump);
+    }
+    
+    ReplayEngine engine;
+    ReplayResult best = {0, 0, 0xFFFFFFFF};
+    
+    for (int run = 0; run < repeat; run++) {
+        FILE* frames = nullptr;
+        if (framesPath != nullptr && run == 0) {
+            frames = fopen(framesPath, "wb");
+            if (frames == nullptr) {
+                fprintf(stderr, "cannot write %s\n", framesPath);
+                return 1;
+            }
+        }
+        
+        ReplayResult result = engine.run(reports.data(), reports.size(), frames ? writeFrame : nullptr, frames);
+        if (frames != nullptr) {
+            fclose(frames);
+        }
+        
+        // Every run of the same trace must produce the same frames
+        if (run > 0 && result.digest != best.digest) {
+            fprintf(stderr, "run %d: digest %08X differs from %08X\n", run, result.digest, best.digest);
+            return 1;
+        }
+        if (result.elapsedUs < best.elapsedUs) {
+            best = result;
+        }
+    }
+    
+    double seconds = best.elapsedUs / 1e6;
+    printf("reports: %u\n", (unsigned)reports.size());
+    printf("frames:  %u\n", best.frames);
+    printf("digest:  %08X\n", best.digest);
+    printf("time:    %.3f ms (%.0f frames/s)\n", best.elapsedUs / 1000.0, seconds > 0 ? best.frames / seconds : 0.0);
+    return 0;
+}